@@ -653,6 +653,80 @@ dnnl_status_t DNNL_API dnnl_post_ops_get_params_eltwise(
         const_dnnl_post_ops_t post_ops, int index, float *scale,
         dnnl_alg_kind_t *alg_kind, float *alpha, float *beta);
 
+/// Appends a depthwise post-op convolution.
+///
+/// This post-op can only be fused with a 2D 1x1 convolution (convolution with
+/// weights spatial dimension equal to 1 i.e., kh=kw=1).
+///
+/// The kind of this post-op is #dnnl_convolution.
+///
+/// The number of outputs for primitive remain same as before. The depthwise
+/// convolution has a square kernel, equal strides and symmetric padding over
+/// both spatial dimensions, so that the output spatial size can be derived as
+/// below:
+///
+/// output_height = (output_height_1x1_convolution + 2 * padding_l_size
+///         - kernel_size) / stride_size + 1
+/// output_width = (output_width_1x1_convolution + 2 * padding_l_size
+///         - kernel_size) / stride_size + 1
+///
+/// The Post-op can be defined as:
+///
+///      dst[:] <- scales * (conv_dw(conv_1x1))
+///
+/// See @ref dev_guide_attributes_post_ops_depthwise and
+/// @ref dev_guide_attributes_post_ops_depthwise_fusion for more info.
+///
+/// @param post_ops Post-ops.
+/// @param weights_data_type Weights data type of depthwise post-op
+/// @param bias_data_type Bias data type of depthwise post-op
+/// @param dst_data_type Output data type of depthwise post-op
+/// @param kernel_size Size of the kernel of depthwise post-op
+/// @param stride_size Size of the stride of depthwise post-op
+/// @param padding_l_size Size of the left and top paddings of depthwise
+///     post-op; must be smaller than @p kernel_size
+/// @param count Output length of the array of scaling factors @p scales.
+/// @param mask Output scaling factors correspondence mask that defines the
+///     correspondence between the output tensor dimensions and the @p
+///     scales array. The set i-th bit indicates that a dedicated output scaling
+///     factor is used for each index along that dimension. The mask value of 0
+///     implies a common scaling factor for the whole output tensor.
+/// @param scales Output pointer to a constant array of float scaling factors.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise
+dnnl_status_t DNNL_API dnnl_post_ops_append_dw(dnnl_post_ops_t post_ops,
+        dnnl_data_type_t weights_data_type, dnnl_data_type_t bias_data_type,
+        dnnl_data_type_t dst_data_type, dnnl_dim_t kernel_size,
+        dnnl_dim_t stride_size, dnnl_dim_t padding_l_size, dnnl_dim_t count,
+        int mask, const float *scales);
+
+/// Returns the parameters of an depthwise post-op.
+///
+/// @param post_ops Post-ops.
+/// @param index Index of the depthwise post-op.
+/// @param weights_data_type Weights data type of depthwise post-op
+/// @param bias_data_type Bias data type of depthwise post-op
+/// @param dst_data_type Output data type of depthwise post-op
+/// @param kernel_size Size of the kernel of depthwise post-op
+/// @param stride_size Size of the stride of depthwise post-op
+/// @param padding_l_size Size of the left and top paddings of depthwise
+///     post-op
+/// @param count Output length of the array of scaling factors @p scales.
+/// @param mask Output scaling factors correspondence mask that defines the
+///     correspondence between the output tensor dimensions and the @p
+///     scales array. The set i-th bit indicates that a dedicated output scaling
+///     factor is used for each index along that dimension. The mask value of 0
+///     implies a common scaling factor for the whole output tensor.
+/// @param scales Output pointer to a constant array of float scaling factors.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise
+dnnl_status_t DNNL_API dnnl_post_ops_get_params_dw(
+        const_dnnl_post_ops_t post_ops, int index,
+        dnnl_data_type_t *weights_data_type, dnnl_data_type_t *bias_data_type,
+        dnnl_data_type_t *dst_data_type, dnnl_dim_t *kernel_size,
+        dnnl_dim_t *stride_size, dnnl_dim_t *padding_l_size, dnnl_dim_t *count,
+        int *mask, const float **scales);
+
 /// Appends a depthwise post-op convolution with stride 1.
 ///
 /// This post-op can only be fused with a 2D 1x1 convolution (convolution with
@@ -3622,6 +3696,25 @@ size_t DNNL_API dnnl_engine_get_count(dnnl_engine_kind_t kind);
 dnnl_status_t DNNL_API dnnl_engine_create(
         dnnl_engine_t *engine, dnnl_engine_kind_t kind, size_t index);
 
+/// Creates an engine that uses a user-provided allocator for the memory
+/// objects and scratchpads allocated by the library.
+///
+/// @note
+///     Only CPU engines are supported. The allocator must remain usable until
+///     all the memory objects and primitives created on the engine are
+///     destroyed.
+///
+/// @param engine Output engine.
+/// @param kind Engine kind.
+/// @param index Engine index that should be between 0 and the count of
+///     engines of the requested kind.
+/// @param allocator User-provided allocator. The structure is copied.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_engine_create_with_allocator(dnnl_engine_t *engine,
+        dnnl_engine_kind_t kind, size_t index,
+        const dnnl_allocator_t *allocator);
+
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 /// Creates an engine associated with an OpenCL device and an OpenCL context.
 ///
@@ -3664,6 +3757,70 @@ dnnl_status_t DNNL_API dnnl_engine_get_ocl_device(
         dnnl_engine_t engine, cl_device_id *device);
 #endif
 
+/// Returns the maximal total size of the free scratchpad buffers kept by an
+/// engine for reuse.
+///
+/// @param engine Engine to query.
+/// @param capacity Output capacity of the scratchpad pool in bytes.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_engine_get_scratchpad_pool_capacity(
+        dnnl_engine_t engine, size_t *capacity);
+
+/// Sets the maximal total size of the free scratchpad buffers kept by an
+/// engine for reuse.
+///
+/// The library-managed scratchpads of the primitives that do not use the
+/// global scratchpad are returned to the engine pool when the primitives are
+/// destroyed, and are reused by the primitives created later on the same
+/// engine. The default capacity is 128 MB and can be changed with the
+/// DNNL_SCRATCHPAD_POOL_CAPACITY environment variable (in megabytes).
+///
+/// @param engine Engine to configure.
+/// @param capacity Scratchpad pool capacity to set in bytes. If the new
+///     capacity is less than the total size of the free buffers the excess
+///     buffers are freed. Setting the capacity to 0 frees all the free
+///     buffers and disables the pool. Concurrently modifying the capacity is
+///     safe.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_engine_set_scratchpad_pool_capacity(
+        dnnl_engine_t engine, size_t capacity);
+
+/// Sets the placement of the large buffers allocated by a CPU engine.
+///
+/// The placement applies to the memory objects and scratchpads of at least
+/// 2 MB allocated by the library after the call. It is applied on a best
+/// effort basis: if the system does not support a policy (for example, no
+/// huge pages are available or the system has a single NUMA node) the
+/// buffers silently fall back to the default placement.
+///
+/// @note
+///     The placement is only supported on Linux and cannot be combined with
+///     a user-provided allocator.
+///
+/// @param engine Engine to configure. Must be a CPU engine.
+/// @param flags Placement flags, a combination of
+///     #dnnl_cpu_memory_placement_flags_t values.
+///     #dnnl_cpu_memory_placement_numa_interleave and
+///     #dnnl_cpu_memory_placement_numa_bind are mutually exclusive.
+/// @param numa_node NUMA node to bind the buffers to. Used only with
+///     #dnnl_cpu_memory_placement_numa_bind.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_engine_set_cpu_memory_placement(
+        dnnl_engine_t engine, unsigned flags, int numa_node);
+
+/// Returns the placement of the large buffers allocated by a CPU engine.
+///
+/// @param engine Engine to query. Must be a CPU engine.
+/// @param flags Output placement flags.
+/// @param numa_node Output NUMA node the buffers are bound to.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_engine_get_cpu_memory_placement(
+        dnnl_engine_t engine, unsigned *flags, int *numa_node);
+
 /// Destroys an engine.
 ///
 /// @param engine Engine to destroy.
@@ -3821,7 +3978,9 @@ dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 /// @param level Verbosity level:
 ///  - 0: no verbose output (default),
 ///  - 1: primitive information at execution,
-///  - 2: primitive information at creation and execution.
+///  - 2: primitive information at creation and execution,
+///  - 3: same as 2 plus per-thread work-imbalance statistics of the
+///       parallel regions at execution.
 /// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
 ///     @p level value is invalid, and #dnnl_success/#dnnl::status::success on
 ///     success.
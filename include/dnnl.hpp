@@ -610,7 +610,22 @@ enum class normalization_flags : unsigned {
     /// the workspace to implement backward propagation. On inference, the
     /// workspace is not required and behavior is the same as when normalization
     /// is fused with ReLU using the post-ops API.
-    fuse_norm_relu = dnnl_fuse_norm_relu
+    fuse_norm_relu = dnnl_fuse_norm_relu,
+
+    /// Fuse normalization with Add of a second source. If specified, the
+    /// user is expected to pass the second source as an input on forward
+    /// propagation, and the normalization is applied to its sum with the
+    /// source. Only supported by the layer normalization primitive on
+    /// forward inference.
+    fuse_add_norm = dnnl_fuse_add_norm,
+
+    /// Fuse normalization with Add of a second source and ReLU. If
+    /// specified, the user is expected to pass the second source as an input
+    /// on forward propagation, and the library computes its derivative on
+    /// backward propagation. On training, normalization will require the
+    /// workspace to implement backward propagation. Only supported by the
+    /// batch normalization primitive.
+    fuse_norm_add_relu = dnnl_fuse_norm_add_relu
 };
 
 /// Converts normalization flags enum value from C++ API to C API type.
@@ -851,6 +866,19 @@ struct engine : public handle<dnnl_engine_t> {
 
     using handle::handle;
 
+    /// Placement of the large buffers allocated by a CPU engine. Can be
+    /// combined using the bitwise OR operator.
+    enum class cpu_memory_placement : unsigned {
+        /// Default placement.
+        default_placement = dnnl_cpu_memory_placement_default,
+        /// Back the large buffers with huge pages.
+        huge_pages = dnnl_cpu_memory_placement_huge_pages,
+        /// Interleave the large buffers across all NUMA nodes.
+        numa_interleave = dnnl_cpu_memory_placement_numa_interleave,
+        /// Bind the large buffers to a single NUMA node.
+        numa_bind = dnnl_cpu_memory_placement_numa_bind,
+    };
+
     /// Constructs an empty engine. An empty engine cannot be used in any
     /// operations.
     engine() = default;
@@ -876,6 +904,24 @@ struct engine : public handle<dnnl_engine_t> {
         reset(engine);
     }
 
+    /// Constructs an engine that uses a user-provided allocator for the
+    /// memory objects and scratchpads allocated by the library.
+    ///
+    /// @param kind The kind of engine to construct. Only #kind::cpu is
+    ///     supported.
+    /// @param index The index of the engine. Must be less than the value
+    ///     returned by #get_count() for this particular kind of engine.
+    /// @param allocator User-provided allocator. The allocator must remain
+    ///     usable until all the memory objects and primitives created on the
+    ///     engine are destroyed.
+    engine(kind kind, size_t index, const dnnl_allocator_t &allocator) {
+        dnnl_engine_t engine;
+        error::wrap_c_api(dnnl_engine_create_with_allocator(&engine,
+                                  convert_to_c(kind), index, &allocator),
+                "could not create an engine with a user-provided allocator");
+        reset(engine);
+    }
+
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
     /// Constructs an engine from OpenCL device and context objects.
     ///
@@ -914,6 +960,56 @@ struct engine : public handle<dnnl_engine_t> {
         return static_cast<engine::kind>(kind);
     }
 
+    /// Returns the maximal total size of the free scratchpad buffers kept by
+    /// the engine for reuse.
+    /// @returns Scratchpad pool capacity in bytes.
+    size_t get_scratchpad_pool_capacity() const {
+        size_t capacity = 0;
+        error::wrap_c_api(
+                dnnl_engine_get_scratchpad_pool_capacity(get(), &capacity),
+                "could not get scratchpad pool capacity of an engine");
+        return capacity;
+    }
+
+    /// Sets the maximal total size of the free scratchpad buffers kept by
+    /// the engine for reuse.
+    /// @sa dnnl_engine_set_scratchpad_pool_capacity()
+    /// @param capacity Scratchpad pool capacity in bytes. Setting it to 0
+    ///     frees all the free buffers and disables the pool.
+    void set_scratchpad_pool_capacity(size_t capacity) {
+        error::wrap_c_api(
+                dnnl_engine_set_scratchpad_pool_capacity(get(), capacity),
+                "could not set scratchpad pool capacity of an engine");
+    }
+
+    /// Sets the placement of the large buffers allocated by the CPU engine.
+    /// @sa dnnl_engine_set_cpu_memory_placement()
+    /// @param placement Placement flags.
+    /// @param numa_node NUMA node to bind the buffers to. Used only with
+    ///     #cpu_memory_placement::numa_bind.
+    void set_cpu_memory_placement(
+            cpu_memory_placement placement, int numa_node = 0) {
+        error::wrap_c_api(dnnl_engine_set_cpu_memory_placement(get(),
+                                  static_cast<unsigned>(placement), numa_node),
+                "could not set CPU memory placement of an engine");
+    }
+
+    /// Returns the placement of the large buffers allocated by the CPU
+    /// engine.
+    /// @param numa_node Output NUMA node the buffers are bound to. May be
+    ///     nullptr.
+    /// @returns Placement flags.
+    cpu_memory_placement get_cpu_memory_placement(
+            int *numa_node = nullptr) const {
+        unsigned flags = 0;
+        int node = 0;
+        error::wrap_c_api(
+                dnnl_engine_get_cpu_memory_placement(get(), &flags, &node),
+                "could not get CPU memory placement of an engine");
+        if (numa_node) *numa_node = node;
+        return static_cast<cpu_memory_placement>(flags);
+    }
+
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
     /// Returns the OpenCL context associated with the engine.
     /// @returns OpenCL context.
@@ -959,6 +1055,8 @@ private:
     }
 };
 
+DNNL_DEFINE_BITMASK_OPS(engine::cpu_memory_placement)
+
 /// Converts engine kind enum value from C++ API to C API type.
 ///
 /// @param kind C++ API engine kind enum value.
@@ -2325,6 +2423,109 @@ struct post_ops : public handle<dnnl_post_ops_t> {
         algorithm = static_cast<dnnl::algorithm>(c_alg);
     }
 
+    /// Appends a depthwise post-op convolution.
+    ///
+    /// This post-op can only be fused with a 2D 1x1 convolution (convolution
+    /// with weights spatial dimension equal to 1 i.e., kh=kw=1).
+    ///
+    /// The kind of this post-op is #dnnl_convolution.
+    ///
+    /// The number of outputs for primitive remain same as before. The output
+    /// spatial size is derived from the 1x1 convolution output spatial size
+    /// as in a convolution with a square kernel of @p kernel_size, equal
+    /// strides of @p stride_size and symmetric paddings of @p padding_l_size.
+    ///
+    /// The Post-op can be defined as:
+    ///
+    ///      dst[:] <- scales * (conv_dw(conv_1x1))
+    ///
+    /// See @ref dev_guide_attributes_post_ops_depthwise and
+    /// @ref dev_guide_attributes_post_ops_depthwise_fusion for more info.
+    ///
+    /// @param weights_data_type Weights data type of depthwise post-op
+    /// @param bias_data_type Bias data type of depthwise post-op
+    /// @param dst_data_type Output data type of depthwise post-op
+    /// @param kernel_size Size of the kernel of depthwise post-op
+    /// @param stride_size Size of the stride of depthwise post-op
+    /// @param padding_l_size Size of the left and top paddings of depthwise
+    ///     post-op; must be smaller than @p kernel_size
+    /// @param mask Output scaling factors correspondence mask that defines the
+    ///     correspondence between the output tensor dimensions and the
+    ///     @p scales array. The set i-th bit indicates that a dedicated output
+    ///     scaling factor is used for each index along that dimension. The mask
+    ///     value of 0 implies a common scaling factor for the whole output
+    ///     tensor.
+    /// @param scales Output pointer to a constant array of float scaling
+    ///     factors.
+    void append_dw(memory::data_type weights_data_type,
+            memory::data_type bias_data_type, memory::data_type dst_data_type,
+            memory::dim kernel_size, memory::dim stride_size,
+            memory::dim padding_l_size, int mask,
+            const std::vector<float> &scales) {
+
+        error::wrap_c_api(dnnl_post_ops_append_dw(get(),
+                                  memory::convert_to_c(weights_data_type),
+                                  memory::convert_to_c(bias_data_type),
+                                  memory::convert_to_c(dst_data_type),
+                                  kernel_size, stride_size, padding_l_size,
+                                  scales.size(), mask, &scales[0]),
+                "could not append depthwise post-op");
+    }
+
+    /// Returns the parameters of an depthwise post-op.
+    ///
+    /// @param index Index of the depthwise post-op.
+    /// @param weights_data_type Weights data type of depthwise post-op
+    /// @param bias_data_type Bias data type of depthwise post-op
+    /// @param dst_data_type Output data type of depthwise post-op
+    /// @param kernel_size Size of the kernel of depthwise post-op
+    /// @param stride_size Size of the stride of depthwise post-op
+    /// @param padding_l_size Size of the left and top paddings of depthwise
+    ///     post-op
+    /// @param mask Output scaling factors correspondence mask that defines the
+    ///     correspondence between the output tensor dimensions and the
+    ///     @p scales array. The set i-th bit indicates that a dedicated output
+    ///     scaling factor is used for each index along that dimension. The mask
+    ///     value of 0 implies a common scaling factor for the whole output
+    ///     tensor.
+    /// @param scales Output pointer to a constant array of float scaling
+    ///     factors.
+    void get_params_dw(int index, memory::data_type &weights_data_type,
+            memory::data_type &bias_data_type, memory::data_type &dst_data_type,
+            memory::dim &kernel_size, memory::dim &stride_size,
+            memory::dim &padding_l_size, int &mask,
+            std::vector<float> &scales) const {
+
+        dnnl_data_type_t c_weights_data_type;
+        dnnl_data_type_t c_bias_data_type;
+        dnnl_data_type_t c_dst_data_type;
+        dnnl_dim_t c_kernel_size;
+        dnnl_dim_t c_stride_size;
+        dnnl_dim_t c_padding_l_size;
+        dnnl_dim_t count;
+        int c_mask;
+        const float *c_scales;
+        error::wrap_c_api(
+                dnnl_post_ops_get_params_dw(get(), index, &c_weights_data_type,
+                        &c_bias_data_type, &c_dst_data_type, &c_kernel_size,
+                        &c_stride_size, &c_padding_l_size, &count, &c_mask,
+                        &c_scales),
+                "could not get parameters of depthwise post-op");
+
+        weights_data_type = static_cast<memory::data_type>(c_weights_data_type);
+        bias_data_type = static_cast<memory::data_type>(c_bias_data_type);
+        dst_data_type = static_cast<memory::data_type>(c_dst_data_type);
+        kernel_size = c_kernel_size;
+        stride_size = c_stride_size;
+        padding_l_size = c_padding_l_size;
+        scales.resize(count);
+
+        mask = c_mask;
+        for (dnnl_dim_t c = 0; c < count; ++c)
+            scales[c] = c_scales[c];
+        return;
+    }
+
     /// Appends a depthwise post-op convolution with stride 1.
     ///
     /// This post-op can only be fused with a 2D 1x1 convolution (convolution
@@ -6340,6 +6541,9 @@ struct batch_normalization_forward : public primitive {
         ///  - `scale_and_shift` (#dnnl::primitive_desc_base::weights_desc(`0`)),
         ///     if #dnnl::normalization_flags::use_scale_shift bit-flag is set
         ///     in @p flags
+        ///  - `src_1` (#dnnl::primitive_desc_base::src_desc(`3`)),
+        ///     if #dnnl::normalization_flags::fuse_norm_add_relu bit-flag is
+        ///     set in @p flags
         ///
         /// Outputs:
         ///  - `dst` (#dnnl::primitive_desc_base::dst_desc(`0`))
@@ -6352,7 +6556,8 @@ struct batch_normalization_forward : public primitive {
         ///     not set in @p flags and @p prop_kind =
         ///     #dnnl::prop_kind::forward_training
         ///  - `workspace` (#dnnl::primitive_desc_base::workspace_desc(`0`)),
-        ///     if #dnnl::normalization_flags::fuse_norm_relu bit-flag is set
+        ///     if #dnnl::normalization_flags::fuse_norm_relu or
+        ///     #dnnl::normalization_flags::fuse_norm_add_relu bit-flag is set
         ///     in @p flags and @p prop_kind =
         ///     #dnnl::prop_kind::forward_training; must be queried
         ///     for using @ref primitive_desc_base::query_md() after a
@@ -6496,7 +6701,8 @@ struct batch_normalization_backward : public primitive {
         ///     if #dnnl::normalization_flags::use_scale_shift bit-flag is
         ///     set in @p flags
         ///  - `workspace` (#dnnl::primitive_desc_base::workspace_desc(`0`)),
-        ///     if #dnnl::normalization_flags::fuse_norm_relu bit-flag is set
+        ///     if #dnnl::normalization_flags::fuse_norm_relu or
+        ///     #dnnl::normalization_flags::fuse_norm_add_relu bit-flag is set
         ///     in @p flags
         ///
         /// Outputs:
@@ -6505,6 +6711,9 @@ struct batch_normalization_backward : public primitive {
         ///     (#dnnl::primitive_desc_base::diff_weights_desc(`0`)),
         ///     if #dnnl::normalization_flags::use_scale_shift bit-flag is
         ///     set in @p flags and @p prop_kind = #dnnl::prop_kind::backward
+        ///  - `diff_src_1` (#dnnl::primitive_desc_base::diff_src_desc(`1`)),
+        ///     if #dnnl::normalization_flags::fuse_norm_add_relu bit-flag is
+        ///     set in @p flags
         ///
         /// @param prop_kind Propagation kind. Possible values are
         ///     #dnnl::prop_kind::backward_data and #dnnl::prop_kind::backward
@@ -6670,6 +6879,9 @@ struct layer_normalization_forward : public primitive {
         ///  - `scale_and_shift` (#dnnl::primitive_desc_base::weights_desc(`0`)),
         ///     if #dnnl::normalization_flags::use_scale_shift bit-flag is set
         ///     in @p flags
+        ///  - `src_1` (#dnnl::primitive_desc_base::src_desc(`3`)),
+        ///     if #dnnl::normalization_flags::fuse_add_norm bit-flag is set
+        ///     in @p flags
         ///
         /// Outputs:
         ///  - `dst` (#dnnl::primitive_desc_base::dst_desc(`0`))
@@ -6715,6 +6927,9 @@ struct layer_normalization_forward : public primitive {
         ///  - `scale_and_shift` (#dnnl::primitive_desc_base::weights_desc(`0`)),
         ///     if #dnnl::normalization_flags::use_scale_shift bit-flag is set
         ///     in @p flags
+        ///  - `src_1` (#dnnl::primitive_desc_base::src_desc(`3`)),
+        ///     if #dnnl::normalization_flags::fuse_add_norm bit-flag is set
+        ///     in @p flags
         ///
         /// Outputs:
         ///  - `dst` (#dnnl::primitive_desc_base::dst_desc(`0`))
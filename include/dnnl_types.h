@@ -958,6 +958,34 @@ typedef enum {
     ///  - on training primitive requires workspace (required to be able to
     ///    perform backward pass)
     dnnl_fuse_norm_relu = 0x4U,
+
+    /// Fuse with Add of a second source
+    ///
+    /// If specified:
+    ///  - on forward propagation the second source (#DNNL_ARG_SRC_1) is added
+    ///    to the source element-wise and the normalization is applied to the
+    ///    sum. The second source has the same memory descriptor as the source.
+    ///
+    /// Only supported by the layer normalization primitive on forward
+    /// inference.
+    dnnl_fuse_add_norm = 0x8U,
+
+    /// Fuse with Add of a second source and ReLU
+    ///
+    /// If specified:
+    ///  - on forward propagation the second source (#DNNL_ARG_SRC_1) is added
+    ///    to the result of the normalization element-wise and ReLU with zero
+    ///    negative slope is applied to the sum. The second source has the
+    ///    same memory descriptor as the source.
+    ///  - on training primitive requires workspace (required to be able to
+    ///    perform backward pass)
+    ///  - on backward propagation the primitive additionally computes the
+    ///    diff of the second source (#DNNL_ARG_DIFF_SRC_1), which has the
+    ///    same memory descriptor as the diff of the source.
+    ///
+    /// Cannot be combined with #dnnl_fuse_norm_relu. Only supported by the
+    /// batch normalization primitive.
+    dnnl_fuse_norm_add_relu = 0x10U,
 } dnnl_normalization_flags_t;
 
 /// @} dnnl_api_primitives_common
@@ -1033,7 +1061,9 @@ typedef enum {
     dnnl_wino_wei_aaOio, ///< Internal weights format for 2x3 Winograd
     dnnl_wino_wei_aaOBiOo, ///< Internal weights format for 2x3 Winograd
     // Tensor of weights for 4x3 convolution.
-    dnnl_wino_wei_OBaaIBOIio ///< Internal weights format for 4x3 Winograd
+    dnnl_wino_wei_OBaaIBOIio, ///< Internal weights format for 4x3 Winograd
+    // Tensor of weights for 2x3 and 4x3 AVX2 winograd convolutions.
+    dnnl_wino_wei_aaIO ///< Internal weights format for AVX2 Winograd
 } dnnl_wino_memory_format_t;
 
 /// Description of tensor of weights for winograd 2x3 convolution.
@@ -1723,6 +1753,48 @@ typedef struct dnnl_engine *dnnl_engine_t;
 typedef const struct dnnl_engine *const_dnnl_engine_t;
 #endif
 
+/// A user-provided memory allocation function.
+///
+/// @param size Size of the requested buffer in bytes.
+/// @param alignment Required alignment of the buffer in bytes. Always a power
+///     of two.
+/// @param user_data User data passed to the allocator at engine creation.
+/// @returns Pointer to the allocated buffer or NULL on failure.
+typedef void *(*dnnl_allocate_f)(size_t size, size_t alignment, void *user_data);
+
+/// A user-provided memory deallocation function.
+///
+/// @param ptr Pointer to a buffer returned by the matching #dnnl_allocate_f.
+/// @param size Size of the buffer in bytes, same as the one passed to the
+///     allocation function.
+/// @param user_data User data passed to the allocator at engine creation.
+typedef void (*dnnl_free_f)(void *ptr, size_t size, void *user_data);
+
+/// @brief A user-provided memory allocator.
+typedef struct {
+    /// Allocation function.
+    dnnl_allocate_f allocate;
+    /// Deallocation function.
+    dnnl_free_f free;
+    /// User data passed to the allocation and deallocation functions.
+    void *user_data;
+} dnnl_allocator_t;
+
+/// Flags controlling the placement of the large buffers allocated by a CPU
+/// engine. The flags can be combined via bitwise OR.
+typedef enum {
+    /// Default placement: the buffers are allocated with the regular aligned
+    /// allocation and placed by the operating system.
+    dnnl_cpu_memory_placement_default = 0x0U,
+    /// Back the large buffers with huge pages. Explicitly reserved huge pages
+    /// are used if available, otherwise transparent huge pages are requested.
+    dnnl_cpu_memory_placement_huge_pages = 0x1U,
+    /// Interleave the pages of the large buffers across all NUMA nodes.
+    dnnl_cpu_memory_placement_numa_interleave = 0x2U,
+    /// Bind the pages of the large buffers to a single NUMA node.
+    dnnl_cpu_memory_placement_numa_bind = 0x4U,
+} dnnl_cpu_memory_placement_flags_t;
+
 /// @} dnnl_api_engine
 
 /// @addtogroup dnnl_api_primitives
@@ -69,10 +69,14 @@ status_t bnrm_desc_init(batch_normalization_desc_t *bnrm_desc,
             &bd.stat_desc, 1, stats_dims, data_type::f32, dnnl_x);
     bd.batch_norm_epsilon = epsilon;
 
-    unsigned bnorm_flags
-            = dnnl_use_global_stats | dnnl_use_scaleshift | dnnl_fuse_norm_relu;
+    unsigned bnorm_flags = dnnl_use_global_stats | dnnl_use_scaleshift
+            | dnnl_fuse_norm_relu | dnnl_fuse_norm_add_relu;
     if ((~bnorm_flags & flags) != 0) return invalid_arguments;
 
+    // ReLU is already a part of the fused add
+    if ((flags & dnnl_fuse_norm_relu) && (flags & dnnl_fuse_norm_add_relu))
+        return invalid_arguments;
+
     bd.flags = flags;
 
     bool consistency = true && utils::one_of(bd.data_desc.ndims, 2, 3, 4, 5);
@@ -76,6 +76,9 @@ struct batch_normalization_pd_t : public primitive_desc_t {
         return desc_.flags & dnnl_use_global_stats;
     }
     bool fuse_norm_relu() const { return desc_.flags & dnnl_fuse_norm_relu; }
+    bool fuse_norm_add_relu() const {
+        return desc_.flags & dnnl_fuse_norm_add_relu;
+    }
     bool with_relu_post_op() const {
         const auto &p = this->attr()->post_ops_;
         return p.len_ == 1 && p.entry_[0].is_relu(true, true);
@@ -141,7 +144,11 @@ struct batch_normalization_fwd_pd_t : public batch_normalization_pd_t {
         if (arg == DNNL_ARG_SCALE_SHIFT && use_scaleshift())
             return arg_usage_t::input;
 
-        if (arg == DNNL_ARG_WORKSPACE && is_training() && fuse_norm_relu())
+        if (arg == DNNL_ARG_SRC_1 && fuse_norm_add_relu())
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_WORKSPACE && is_training()
+                && (fuse_norm_relu() || fuse_norm_add_relu()))
             return arg_usage_t::output;
 
         return primitive_desc_t::arg_usage(arg);
@@ -155,6 +162,7 @@ struct batch_normalization_fwd_pd_t : public batch_normalization_pd_t {
             case DNNL_ARG_VARIANCE:
                 return stats_is_src() ? src_md(2) : dst_md(2);
             case DNNL_ARG_SCALE_SHIFT: return weights_md(0);
+            case DNNL_ARG_SRC_1: return src_md(3);
             default: return batch_normalization_pd_t::arg_md(arg);
         }
     }
@@ -162,6 +170,7 @@ struct batch_normalization_fwd_pd_t : public batch_normalization_pd_t {
     const memory_desc_t *src_md(int index = 0) const override {
         if (index == 0) return &data_md_;
         if (stats_is_src() && (index == 1 || index == 2)) return &stat_md_;
+        if (fuse_norm_add_relu() && index == 3) return &data_md_;
         return &glob_zero_md;
     }
 
@@ -177,8 +186,10 @@ struct batch_normalization_fwd_pd_t : public batch_normalization_pd_t {
     }
 
     const memory_desc_t *workspace_md(int index = 0) const override {
-        return index == 0 && is_training() && fuse_norm_relu() ? &ws_md_
-                                                               : &glob_zero_md;
+        return index == 0 && is_training()
+                        && (fuse_norm_relu() || fuse_norm_add_relu())
+                ? &ws_md_
+                : &glob_zero_md;
     }
 
     const memory_desc_t *stat_md() const {
@@ -186,10 +197,13 @@ struct batch_normalization_fwd_pd_t : public batch_normalization_pd_t {
     }
 
     int n_inputs() const override {
-        return 1 + 2 * stats_is_src() + use_scaleshift();
+        return 1 + 2 * stats_is_src() + use_scaleshift() + fuse_norm_add_relu();
     }
     int n_outputs() const override {
-        return 1 + (fuse_norm_relu() + 2 * (!stats_is_src())) * is_training();
+        return 1
+                + (fuse_norm_relu() + fuse_norm_add_relu()
+                          + 2 * (!stats_is_src()))
+                * is_training();
     }
 
 protected:
@@ -218,11 +232,15 @@ struct batch_normalization_bwd_pd_t : public batch_normalization_pd_t {
         if (arg == DNNL_ARG_SCALE_SHIFT && use_scaleshift())
             return arg_usage_t::input;
 
-        if (arg == DNNL_ARG_WORKSPACE && fuse_norm_relu())
+        if (arg == DNNL_ARG_WORKSPACE
+                && (fuse_norm_relu() || fuse_norm_add_relu()))
             return arg_usage_t::input;
 
         if (arg == DNNL_ARG_DIFF_SRC) return arg_usage_t::output;
 
+        if (arg == DNNL_ARG_DIFF_SRC_1 && fuse_norm_add_relu())
+            return arg_usage_t::output;
+
         if (arg == DNNL_ARG_DIFF_SCALE_SHIFT && use_scaleshift())
             return arg_usage_t::output;
 
@@ -238,6 +256,7 @@ struct batch_normalization_bwd_pd_t : public batch_normalization_pd_t {
             case DNNL_ARG_DIFF_SRC: return diff_src_md(0);
             case DNNL_ARG_DIFF_DST: return diff_dst_md(0);
             case DNNL_ARG_DIFF_SCALE_SHIFT: return diff_weights_md(0);
+            case DNNL_ARG_DIFF_SRC_1: return diff_src_md(1);
             default: return batch_normalization_pd_t::arg_md(arg);
         }
     }
@@ -249,7 +268,9 @@ struct batch_normalization_bwd_pd_t : public batch_normalization_pd_t {
         return index == 0 ? &diff_data_md_ : &glob_zero_md;
     }
     const memory_desc_t *diff_src_md(int index = 0) const override {
-        return index == 0 ? &diff_data_md_ : &glob_zero_md;
+        if (index == 0) return &diff_data_md_;
+        if (fuse_norm_add_relu() && index == 1) return &diff_data_md_;
+        return &glob_zero_md;
     }
 
     const memory_desc_t *weights_md(int index = 0) const override {
@@ -260,16 +281,19 @@ struct batch_normalization_bwd_pd_t : public batch_normalization_pd_t {
     }
 
     const memory_desc_t *workspace_md(int index = 0) const override {
-        return index == 0 && fuse_norm_relu() ? &ws_md_ : &glob_zero_md;
+        return index == 0 && (fuse_norm_relu() || fuse_norm_add_relu())
+                ? &ws_md_
+                : &glob_zero_md;
     }
 
     const memory_desc_t *stat_md() const { return src_md(1); }
 
     int n_inputs() const override {
-        return 4 + use_scaleshift() + fuse_norm_relu();
+        return 4 + use_scaleshift() + fuse_norm_relu() + fuse_norm_add_relu();
     }
     int n_outputs() const override {
-        return 1 + (!types::is_zero_md(diff_weights_md()));
+        return 1 + (!types::is_zero_md(diff_weights_md()))
+                + fuse_norm_add_relu();
     }
 
 protected:
@@ -579,6 +579,8 @@ const engine_kind_t cpu = dnnl_cpu;
 const engine_kind_t gpu = dnnl_gpu;
 } // namespace engine_kind
 
+using allocator_t = dnnl_allocator_t;
+
 enum runtime_kind_t {
     dnnl_runtime_none,
     dnnl_runtime_seq,
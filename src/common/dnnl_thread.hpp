@@ -19,6 +19,7 @@
 
 #include <algorithm>
 
+#include "thread_profiling.hpp"
 #include "utils.hpp"
 #include "z_magic.hpp"
 
@@ -42,6 +43,8 @@ inline int dnnl_in_parallel() {
     return omp_in_parallel();
 }
 inline void dnnl_thr_barrier() {
+    dnnl::impl::thread_profiling::event_scope_t prof_scope(
+            dnnl::impl::thread_profiling::event_t::barrier);
 #pragma omp barrier
 }
 
@@ -38,6 +38,8 @@
  *                                         convenience)
  */
 
+#include "thread_profiling.hpp"
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 #include "counting_barrier.hpp"
 #endif
@@ -68,17 +70,23 @@ void parallel(int nthr, F f) {
         f(0, 1);
         return;
     }
+    // Per-thread instrumentation, a no-op unless the execution is profiled
+    thread_profiling::exec_stats_t *prof = thread_profiling::region_begin(nthr);
+    auto f_prof = [&](int ithr, int nthr) {
+        thread_profiling::thread_scope_t prof_scope(prof, ithr);
+        f(ithr, nthr);
+    };
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
 #pragma omp parallel num_threads(nthr)
     {
         int nthr_ = omp_get_num_threads();
         int ithr_ = omp_get_thread_num();
         assert(nthr_ == nthr);
-        f(ithr_, nthr_);
+        f_prof(ithr_, nthr_);
     }
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
     tbb::parallel_for(
-            0, nthr, [&](int ithr) { f(ithr, nthr); },
+            0, nthr, [&](int ithr) { f_prof(ithr, nthr); },
             tbb::static_partitioner());
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     using namespace dnnl::impl::threadpool_utils;
@@ -86,22 +94,23 @@ void parallel(int nthr, F f) {
     if (!tp || dnnl_in_parallel()) {
         threadpool_utils::deactivate_threadpool();
         for (int ithr = 0; ithr < nthr; ithr++)
-            f(ithr, nthr);
+            f_prof(ithr, nthr);
         threadpool_utils::activate_threadpool(tp);
     } else {
         bool async = tp->get_flags() & dnnl::threadpool_iface::ASYNCHRONOUS;
         counting_barrier_t b;
         if (async) b.init(nthr);
-        tp->parallel_for(nthr, [tp, &f, &b, async](int ithr, int nthr) {
+        tp->parallel_for(nthr, [tp, &f_prof, &b, async](int ithr, int nthr) {
             bool is_master = threadpool_utils::get_active_threadpool() == tp;
             if (!is_master) threadpool_utils::activate_threadpool(tp);
-            f(ithr, nthr);
+            f_prof(ithr, nthr);
             if (!is_master) threadpool_utils::deactivate_threadpool();
             if (async) b.notify();
         });
         if (async) b.wait();
     }
 #endif
+    thread_profiling::region_end(prof);
 #endif
 }
 
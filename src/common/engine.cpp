@@ -70,12 +70,65 @@ status_t dnnl_engine_create(
     return ef->engine_create(engine, index);
 }
 
+status_t dnnl_engine_create_with_allocator(engine_t **engine,
+        engine_kind_t kind, size_t index, const allocator_t *allocator) {
+    bool args_ok = !any_null(engine, allocator)
+            && !any_null(allocator->allocate, allocator->free);
+    if (!args_ok) return invalid_arguments;
+    if (kind != engine_kind::cpu) return unimplemented;
+
+    auto runtime_kind = get_default_runtime(kind);
+    if (!is_native_runtime(runtime_kind)) return unimplemented;
+
+    cpu::cpu_engine_factory_t ef;
+    if (index >= ef.count()) return invalid_arguments;
+
+    return ef.engine_create(engine, index, *allocator);
+}
+
 status_t dnnl_engine_get_kind(engine_t *engine, engine_kind_t *kind) {
     if (engine == nullptr) return invalid_arguments;
     *kind = engine->kind();
     return success;
 }
 
+status_t dnnl_engine_get_scratchpad_pool_capacity(
+        engine_t *engine, size_t *capacity) {
+    if (any_null(engine, capacity)) return invalid_arguments;
+    *capacity = engine->scratchpad_pool()->get_capacity();
+    return success;
+}
+
+status_t dnnl_engine_set_scratchpad_pool_capacity(
+        engine_t *engine, size_t capacity) {
+    if (engine == nullptr) return invalid_arguments;
+    return engine->scratchpad_pool()->set_capacity(capacity);
+}
+
+status_t dnnl_engine_set_cpu_memory_placement(
+        engine_t *engine, unsigned flags, int numa_node) {
+    if (engine == nullptr || engine->kind() != engine_kind::cpu)
+        return invalid_arguments;
+    if (!is_native_runtime(engine->runtime_kind())) return unimplemented;
+
+    auto cpu_engine = utils::downcast<cpu::cpu_engine_t *>(engine);
+    return cpu_engine->set_memory_placement({flags, numa_node});
+}
+
+status_t dnnl_engine_get_cpu_memory_placement(
+        engine_t *engine, unsigned *flags, int *numa_node) {
+    if (any_null(engine, flags, numa_node)
+            || engine->kind() != engine_kind::cpu)
+        return invalid_arguments;
+    if (!is_native_runtime(engine->runtime_kind())) return unimplemented;
+
+    auto cpu_engine = utils::downcast<cpu::cpu_engine_t *>(engine);
+    const auto placement = cpu_engine->get_memory_placement();
+    *flags = placement.flags;
+    *numa_node = placement.numa_node;
+    return success;
+}
+
 status_t dnnl_engine_destroy(engine_t *engine) {
     /* TODO: engine->dec_ref_count(); */
     delete engine;
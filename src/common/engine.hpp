@@ -17,12 +17,15 @@
 #ifndef COMMON_ENGINE_HPP
 #define COMMON_ENGINE_HPP
 
+#include <memory>
+
 #include "dnnl.h"
 
 #include "c_types_map.hpp"
 #include "memory.hpp"
 #include "memory_storage.hpp"
 #include "primitive_desc.hpp"
+#include "scratchpad_pool.hpp"
 #include "utils.hpp"
 
 /** \brief An abstraction of an execution unit with shared resources
@@ -34,7 +37,10 @@
 struct dnnl_engine : public dnnl::impl::c_compatible {
     dnnl_engine(dnnl::impl::engine_kind_t kind,
             dnnl::impl::runtime_kind_t runtime_kind)
-        : kind_(kind), runtime_kind_(runtime_kind) {}
+        : kind_(kind)
+        , runtime_kind_(runtime_kind)
+        , scratchpad_pool_(std::make_shared<dnnl::impl::scratchpad_pool_t>(
+                  dnnl::impl::get_default_scratchpad_pool_capacity())) {}
     virtual ~dnnl_engine() = default;
 
     /** get kind of the current engine */
@@ -45,6 +51,10 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
 
     virtual intptr_t device_id() const { return 0; }
 
+    /** returns true if library-allocated memory comes from a user-provided
+     * allocator */
+    virtual bool has_user_allocator() const { return false; }
+
     /** create memory storage */
     virtual dnnl::impl::status_t create_memory_storage(
             dnnl::impl::memory_storage_t **storage, unsigned flags, size_t size,
@@ -56,6 +66,13 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
                 storage, dnnl::impl::memory_flags_t::alloc, size, nullptr);
     }
 
+    /** get the pool of library-managed scratchpads. The scratchpads share
+     * the ownership of the pool, as they may outlive the engine */
+    const std::shared_ptr<dnnl::impl::scratchpad_pool_t> &
+    scratchpad_pool() const {
+        return scratchpad_pool_;
+    }
+
     /** create stream */
     virtual dnnl::impl::status_t create_stream(dnnl::impl::stream_t **stream,
             unsigned flags, const dnnl::impl::stream_attr_t *attr)
@@ -115,6 +132,7 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
 protected:
     dnnl::impl::engine_kind_t kind_;
     dnnl::impl::runtime_kind_t runtime_kind_;
+    std::shared_ptr<dnnl::impl::scratchpad_pool_t> scratchpad_pool_;
 };
 
 namespace dnnl {
@@ -37,7 +37,12 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
                     backward_data, backward)
             && 2 <= data_desc->ndims && data_desc->ndims <= 5
             && IMPLICATION(prop_kind & backward, diff_data_desc != nullptr)
-            && (flags & ~(dnnl_use_global_stats | dnnl_use_scaleshift)) == 0;
+            && (flags
+                       & ~(dnnl_use_global_stats | dnnl_use_scaleshift
+                               | dnnl_fuse_add_norm))
+                    == 0
+            && IMPLICATION(flags & dnnl_fuse_add_norm,
+                    prop_kind == forward_inference);
     if (!args_ok) return invalid_arguments;
 
     auto ld = layer_normalization_desc_t();
@@ -73,6 +73,7 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     bool use_global_stats() const {
         return desc_.flags & dnnl_use_global_stats;
     }
+    bool fuse_add_norm() const { return desc_.flags & dnnl_fuse_add_norm; }
 
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
@@ -146,12 +147,16 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         if (arg == DNNL_ARG_SCALE_SHIFT && use_scaleshift())
             return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_SRC_1 && fuse_add_norm())
+            return arg_usage_t::input;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
     const memory_desc_t *arg_md(int arg) const override {
         switch (arg) {
             case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_SRC_1: return src_md(3);
             case DNNL_ARG_DST: return dst_md(0);
             case DNNL_ARG_MEAN: return stats_are_src() ? src_md(1) : dst_md(1);
             case DNNL_ARG_VARIANCE:
@@ -164,6 +169,7 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     const memory_desc_t *src_md(int index = 0) const override {
         if (index == 0) return &data_md_;
         if (stats_are_src() && (index == 1 || index == 2)) return &stat_md_;
+        if (fuse_add_norm() && index == 3) return &data_md_;
         return &glob_zero_md;
     }
 
@@ -179,7 +185,7 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     }
 
     int n_inputs() const override {
-        return 1 + 2 * stats_are_src() + use_scaleshift();
+        return 1 + 2 * stats_are_src() + use_scaleshift() + fuse_add_norm();
     }
     int n_outputs() const override {
         return 1 + 2 * (!stats_are_src()) * is_training();
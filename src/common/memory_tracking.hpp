@@ -161,6 +161,7 @@ enum {
     key_concat_nelems,
     key_concat_optrs,
     key_concat_tent_dst,
+    key_deconv_sum,
     key_conv_adjusted_scales,
     key_conv_bia_reduction,
     key_conv_bias_bf16_convert_wsp,
@@ -170,6 +171,7 @@ enum {
     key_conv_int_dat_in_acc_dt,
     key_conv_padded_bias,
     key_conv_rtus_space,
+    key_conv_src_zp_compensation,
     key_conv_store_wsp,
     key_conv_tails,
     key_conv_tr_diff_dst,
@@ -190,14 +192,20 @@ enum {
     key_iprod_dst_bf16_convert_wsp,
     key_iprod_dst_reorder,
     key_iprod_int_dat_in_acc_dt,
+    key_iprod_src_quantized,
+    key_iprod_src_scales,
     key_lnorm_tmp_mean,
     key_lnorm_tmp_var,
     key_lnorm_tmp_diff_ss,
     key_lnorm_reduction,
     key_matmul_dst_in_acc_dt,
+    key_matmul_src_quantized,
+    key_matmul_src_scales,
     key_pool_dst_bf16cvt,
     key_pool_dst_plain2blocked_cvt,
     key_pool_ind_plain2blocked_cvt,
+    key_pool_ind_reduction,
+    key_pool_reduction,
     key_pool_src_bf16cvt,
     key_pool_src_plain2blocked_cvt,
     key_reducer_space,
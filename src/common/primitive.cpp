@@ -22,6 +22,7 @@
 #include "primitive_desc.hpp"
 #include "scratchpad_debug.hpp"
 #include "stream.hpp"
+#include "thread_profiling.hpp"
 #include "utils.hpp"
 
 using namespace dnnl::impl;
@@ -106,6 +107,8 @@ status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
     exec_ctx_t ctx(stream, std::move(args));
 
     if (get_verbose()) {
+        thread_profiling::exec_scope_t prof_scope(
+                primitive_iface->pd()->info());
         double ms = get_msec();
         status = primitive_iface->execute(ctx);
         stream->wait();
@@ -310,7 +310,9 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
         };
 
         struct depthwise_conv_t {
-            int stride;
+            dnnl::impl::dim_t kernel;
+            dnnl::impl::dim_t stride;
+            dnnl::impl::dim_t padding;
             dnnl::impl::data_type_t wei_dt;
             dnnl::impl::data_type_t bias_dt;
             dnnl::impl::data_type_t dst_dt;
@@ -371,7 +373,11 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                     break;
                 case primitive_kind::convolution:
                     // Depthwise Only
-                    ret = depthwise_conv.stride == rhs.depthwise_conv.stride
+                    ret = depthwise_conv.kernel == rhs.depthwise_conv.kernel
+                            && depthwise_conv.stride
+                                    == rhs.depthwise_conv.stride
+                            && depthwise_conv.padding
+                                    == rhs.depthwise_conv.padding
                             && depthwise_conv.wei_dt
                                     == rhs.depthwise_conv.wei_dt
                             && depthwise_conv.bias_dt
@@ -424,6 +430,11 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
     dnnl::impl::status_t append_sum(float scale);
     dnnl::impl::status_t append_eltwise(
             float scale, dnnl::impl::alg_kind_t alg, float alpha, float beta);
+    dnnl::impl::status_t append_dw(dnnl::impl::data_type_t wei_dt,
+            dnnl::impl::data_type_t bias_dt, dnnl::impl::data_type_t dst_dt,
+            dnnl::impl::dim_t kernel_size, dnnl::impl::dim_t stride_size,
+            dnnl::impl::dim_t padding_l_size, dnnl::impl::dim_t count,
+            int mask, const float *scales);
     dnnl::impl::status_t append_dw_k3s1p1(dnnl::impl::data_type_t wei_dt,
             dnnl::impl::data_type_t bias_dt, dnnl::impl::data_type_t dst_dt,
             dnnl::impl::dim_t count, int mask, const float *scales);
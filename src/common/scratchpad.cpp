@@ -41,14 +41,20 @@ memory_storage_t *create_scratchpad_memory_storage(
   a concurrent execution
 */
 struct concurrent_scratchpad_t : public scratchpad_t {
-    concurrent_scratchpad_t(engine_t *engine, size_t size) {
-        auto *mem_storage = create_scratchpad_memory_storage(engine, size);
+    concurrent_scratchpad_t(engine_t *engine, size_t size)
+        : pool_(engine->scratchpad_pool()), alloc_size_(0) {
+        auto *mem_storage = pool_->acquire(engine, size, alloc_size_);
         size_ = size;
         if (mem_storage == nullptr) size_ = 0;
 
         mem_storage_.reset(mem_storage);
     }
 
+    ~concurrent_scratchpad_t() {
+        // Return the buffer to the engine pool for reuse by other primitives
+        pool_->release(mem_storage_.release(), alloc_size_);
+    }
+
     const memory_storage_t *get_memory_storage() const override {
         return mem_storage_.get();
     }
@@ -56,8 +62,10 @@ struct concurrent_scratchpad_t : public scratchpad_t {
     size_t size() const override { return size_; }
 
 private:
+    std::shared_ptr<scratchpad_pool_t> pool_;
     std::unique_ptr<memory_storage_t> mem_storage_;
     size_t size_;
+    size_t alloc_size_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(concurrent_scratchpad_t);
 };
@@ -125,7 +133,12 @@ scratchpad_t *create_scratchpad(
      * from different engines.
      * lock global scratchpad to work with CPU engine only.
      */
-    if (use_global_scratchpad && engine->kind() == engine_kind_t::dnnl_cpu)
+    /*
+     * The global scratchpad is shared between engines, hence it cannot be
+     * used by the engines with a user-provided allocator.
+     */
+    if (use_global_scratchpad && engine->kind() == engine_kind_t::dnnl_cpu
+            && !engine->has_user_allocator())
         return new global_scratchpad_t(engine, size);
     else
         return new concurrent_scratchpad_t(engine, size);
@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "engine.hpp"
+#include "utils.hpp"
+
+#include "scratchpad_pool.hpp"
+
+namespace dnnl {
+namespace impl {
+
+size_t get_default_scratchpad_pool_capacity() {
+    // The capacity is set in megabytes
+    static const int capacity_mb
+            = getenv_int("DNNL_SCRATCHPAD_POOL_CAPACITY", 128);
+    return capacity_mb > 0 ? (size_t)capacity_mb * 1024 * 1024 : 0;
+}
+
+scratchpad_pool_t::scratchpad_pool_t(size_t capacity)
+    : capacity_(capacity), size_(0) {
+    for (int c = 0; c < n_classes; ++c)
+        for (int s = 0; s < n_slots; ++s)
+            slots_[c][s] = nullptr;
+}
+
+scratchpad_pool_t::~scratchpad_pool_t() {
+    for (int c = 0; c < n_classes; ++c)
+        for (int s = 0; s < n_slots; ++s)
+            delete slots_[c][s].exchange(nullptr);
+}
+
+int scratchpad_pool_t::get_class(size_t size, size_t &class_size) {
+    size = nstl::max(size, (size_t)1 << min_log2);
+
+    // 2^k < size <= 2^(k + 1)
+    int k = 0;
+    for (size_t s = size - 1; s > 1; s >>= 1)
+        ++k;
+    if (k >= max_log2) return -1;
+
+    const size_t base = (size_t)1 << k;
+    const size_t step = base / n_sub_classes;
+    const size_t n = utils::div_up(size - base, step);
+    class_size = base + n * step;
+    return (k - (min_log2 - 1)) * n_sub_classes + (int)n - 1;
+}
+
+size_t scratchpad_pool_t::get_class_size(int c) {
+    const int k = c / n_sub_classes + min_log2 - 1;
+    const size_t base = (size_t)1 << k;
+    return base + (c % n_sub_classes + 1) * (base / n_sub_classes);
+}
+
+memory_storage_t *scratchpad_pool_t::acquire(
+        engine_t *engine, size_t size, size_t &alloc_size) {
+    alloc_size = size;
+
+    size_t class_size = 0;
+    const int c = capacity_ > 0 ? get_class(size, class_size) : -1;
+    if (c >= 0) {
+        for (int s = 0; s < n_slots; ++s) {
+            memory_storage_t *storage = slots_[c][s].exchange(nullptr);
+            if (storage != nullptr) {
+                size_ -= class_size;
+                alloc_size = class_size;
+                return storage;
+            }
+        }
+        // Allocate the whole class so that the buffer can be reused for any
+        // size of the class later on
+        alloc_size = class_size;
+    }
+
+    memory_storage_t *storage = nullptr;
+    status_t status = engine->create_memory_storage(&storage, alloc_size);
+    if (status != status::success) return nullptr;
+    return storage;
+}
+
+void scratchpad_pool_t::release(memory_storage_t *storage, size_t alloc_size) {
+    if (storage == nullptr) return;
+
+    // Only the buffers of the exact class size can be pooled: the pool might
+    // have been disabled when the buffer was allocated
+    size_t class_size = 0;
+    const int c = get_class(alloc_size, class_size);
+    if (c < 0 || class_size != alloc_size) {
+        delete storage;
+        return;
+    }
+
+    // Reserve the space first, so that concurrent releases cannot exceed the
+    // capacity
+    if (size_.fetch_add(class_size) + class_size <= capacity_) {
+        for (int s = 0; s < n_slots; ++s) {
+            memory_storage_t *expected = nullptr;
+            if (slots_[c][s].compare_exchange_strong(expected, storage))
+                return;
+        }
+    }
+    size_ -= class_size;
+    delete storage;
+}
+
+status_t scratchpad_pool_t::set_capacity(size_t capacity) {
+    capacity_ = capacity;
+    trim();
+    return status::success;
+}
+
+void scratchpad_pool_t::trim() {
+    // Free the largest buffers first
+    for (int c = n_classes - 1; c >= 0 && size_ > capacity_; --c) {
+        for (int s = 0; s < n_slots && size_ > capacity_; ++s) {
+            memory_storage_t *storage = slots_[c][s].exchange(nullptr);
+            if (storage == nullptr) continue;
+            size_ -= get_class_size(c);
+            delete storage;
+        }
+    }
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_SCRATCHPAD_POOL_HPP
+#define COMMON_SCRATCHPAD_POOL_HPP
+
+#include <atomic>
+
+#include "c_types_map.hpp"
+#include "memory_storage.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+/* A pool of scratchpad buffers owned by an engine.
+ *
+ * The buffers are grouped in size classes: each power of two is split into
+ * 4 classes, so that at most 25% of a buffer is wasted. Every class keeps
+ * a small lock-free list of free buffers (an array of atomic slots), hence
+ * taking a buffer from the pool and returning it back never blocks.
+ *
+ * The total size of the free buffers is bounded by the pool capacity. When
+ * the capacity is 0 the pool is disabled and the buffers are allocated and
+ * freed right away, with the exact requested size. */
+struct scratchpad_pool_t : public c_compatible {
+    scratchpad_pool_t(size_t capacity);
+    ~scratchpad_pool_t();
+
+    /** returns a buffer of at least @p size bytes and sets @p alloc_size to
+     * the actual size of the buffer, or returns nullptr on failure */
+    memory_storage_t *acquire(engine_t *engine, size_t size, size_t &alloc_size);
+
+    /** returns the buffer of @p alloc_size bytes to the pool, or frees it if
+     * the pool is full */
+    void release(memory_storage_t *storage, size_t alloc_size);
+
+    /** sets the maximal total size of the free buffers, excess buffers are
+     * freed */
+    status_t set_capacity(size_t capacity);
+    size_t get_capacity() const { return capacity_; }
+
+    /** returns the total size of the free buffers */
+    size_t get_size() const { return size_; }
+
+private:
+    enum {
+        n_sub_classes = 4,
+        min_log2 = 12, // 4 KB, smaller buffers are rounded up
+        max_log2 = 48,
+        n_classes = (max_log2 - min_log2 + 1) * n_sub_classes,
+        n_slots = 8, // free buffers per class
+    };
+
+    /** returns the index of the class the @p size belongs to and sets
+     * @p class_size to its upper bound, or returns -1 if the size is too
+     * big to be pooled */
+    static int get_class(size_t size, size_t &class_size);
+    static size_t get_class_size(int c);
+
+    /** frees free buffers until the total size fits into the capacity */
+    void trim();
+
+    std::atomic<size_t> capacity_;
+    std::atomic<size_t> size_;
+    std::atomic<memory_storage_t *> slots_[n_classes][n_slots];
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scratchpad_pool_t);
+};
+
+/** returns the default capacity of the scratchpad pools in bytes */
+size_t get_default_scratchpad_pool_capacity();
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,169 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#include "dnnl.h"
+
+#include "thread_profiling.hpp"
+#include "verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace thread_profiling {
+
+struct exec_stats_t {
+    enum { n_events = 2 };
+
+    /* Per-thread counters of the current region. Padded to a cache line to
+     * avoid false sharing between the threads of the team. */
+    struct slot_t {
+        double total;
+        double events[n_events];
+        char pad[64 - (1 + n_events) * sizeof(double)];
+    };
+
+    std::vector<slot_t> slots;
+    double region_start = 0;
+
+    /* Accumulated over all the regions of the execution */
+    int nregions = 0;
+    int nthr_max = 0;
+    double wall = 0;
+    double busy_avg = 0;
+    double busy_max = 0;
+    double barrier_avg = 0;
+    double barrier_max = 0;
+    double reduction_avg = 0;
+};
+
+namespace {
+thread_local thread_state_t state = {nullptr, -1};
+
+double now_ms() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(
+            steady_clock::now().time_since_epoch())
+            .count();
+}
+
+int event_idx(event_t event) {
+    return event == event_t::barrier ? 0 : 1;
+}
+} // namespace
+
+exec_stats_t DNNL_API *region_begin(int nthr) {
+    // Only the thread that owns the statistics may open a region. Nested
+    // parallel() calls are accounted to the enclosing region.
+    exec_stats_t *stats = state.stats;
+    if (stats == nullptr || state.ithr != -1) return nullptr;
+
+    exec_stats_t::slot_t zero_slot {};
+    stats->slots.assign(nthr, zero_slot);
+    stats->region_start = now_ms();
+    return stats;
+}
+
+void DNNL_API region_end(exec_stats_t *stats) {
+    if (stats == nullptr) return;
+
+    const double wall = now_ms() - stats->region_start;
+    const int nthr = (int)stats->slots.size();
+    const int barrier = event_idx(event_t::barrier);
+    const int reduction = event_idx(event_t::reduction);
+
+    double busy_sum = 0, busy_max = 0, barrier_sum = 0, barrier_max = 0,
+           reduction_sum = 0;
+    for (const auto &s : stats->slots) {
+        const double busy = s.total - s.events[barrier];
+        busy_sum += busy;
+        busy_max = std::max(busy_max, busy);
+        barrier_sum += s.events[barrier];
+        barrier_max = std::max(barrier_max, s.events[barrier]);
+        reduction_sum += s.events[reduction];
+    }
+
+    stats->nregions++;
+    stats->nthr_max = std::max(stats->nthr_max, nthr);
+    stats->wall += wall;
+    stats->busy_avg += busy_sum / nthr;
+    stats->busy_max += busy_max;
+    stats->barrier_avg += barrier_sum / nthr;
+    stats->barrier_max += barrier_max;
+    stats->reduction_avg += reduction_sum / nthr;
+}
+
+thread_state_t DNNL_API thread_begin(
+        exec_stats_t *stats, int ithr, double &start) {
+    thread_state_t saved = state;
+    state = {stats, ithr};
+    start = now_ms();
+    return saved;
+}
+
+void DNNL_API thread_end(const thread_state_t &saved, double start) {
+    // A thread may execute several chunks of the same region (e.g. with TBB
+    // or a sequential threadpool fallback), hence accumulate
+    state.stats->slots[state.ithr].total += now_ms() - start;
+    state = saved;
+}
+
+exec_stats_t DNNL_API *event_begin(int &ithr, double &start) {
+    if (state.stats == nullptr || state.ithr == -1) return nullptr;
+    ithr = state.ithr;
+    start = now_ms();
+    return state.stats;
+}
+
+void DNNL_API event_end(
+        exec_stats_t *stats, int ithr, event_t event, double start) {
+    stats->slots[ithr].events[event_idx(event)] += now_ms() - start;
+}
+
+exec_scope_t::exec_scope_t(const char *pd_info)
+    : pd_info_(pd_info), stats_(nullptr), saved_(state) {
+    if (get_verbose() < 3 || state.stats != nullptr) return;
+    stats_ = new exec_stats_t;
+    state = {stats_, -1};
+}
+
+exec_scope_t::~exec_scope_t() {
+    if (stats_ == nullptr) return;
+    state = saved_;
+
+    const exec_stats_t &s = *stats_;
+    if (s.nregions > 0) {
+        const double imbalance
+                = s.busy_avg > 0 ? s.busy_max / s.busy_avg : 1.0;
+        printf("dnnl_verbose,exec_threads,%s,regions:%d,nthr:%d,wall:%g,"
+               "busy_avg:%g,busy_max:%g,barrier_avg:%g,barrier_max:%g,"
+               "reduction_avg:%g,imbalance:%g\n",
+                pd_info_, s.nregions, s.nthr_max, s.wall, s.busy_avg,
+                s.busy_max, s.barrier_avg, s.barrier_max, s.reduction_avg,
+                imbalance);
+        fflush(0);
+    }
+    delete stats_;
+}
+
+} // namespace thread_profiling
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_THREAD_PROFILING_HPP
+#define COMMON_THREAD_PROFILING_HPP
+
+/* Per-thread work-imbalance instrumentation of parallel regions.
+ *
+ * When verbose level is 3 or higher, every primitive execution gets an
+ * exec_stats_t object attached to the calling thread (see exec_scope_t).
+ * Each top-level multi-threaded parallel() call made during the execution
+ * becomes a region: every thread records the time it spends in the functor,
+ * the time it waits in barriers, and the time it spends reducing partial
+ * results. Once the execution is over the statistics are summarized in a
+ * `dnnl_verbose,exec_threads` line.
+ *
+ * Nested parallel() calls are accounted to the enclosing region. */
+
+namespace dnnl {
+namespace impl {
+namespace thread_profiling {
+
+struct exec_stats_t;
+
+/* Events tracked inside of a region on top of the total thread time */
+enum class event_t {
+    barrier, // waiting for the other threads of the team
+    reduction, // reducing partial results computed by other threads
+};
+
+/* Profiling state of a thread */
+struct thread_state_t {
+    exec_stats_t *stats;
+    int ithr; // -1 if the thread does not belong to a region
+};
+
+/* Returns the statistics the region should be recorded to or nullptr if the
+ * calling thread is not profiled or is already inside of a region */
+exec_stats_t *region_begin(int nthr);
+void region_end(exec_stats_t *stats);
+
+thread_state_t thread_begin(exec_stats_t *stats, int ithr, double &start);
+void thread_end(const thread_state_t &saved, double start);
+
+exec_stats_t *event_begin(int &ithr, double &start);
+void event_end(exec_stats_t *stats, int ithr, event_t event, double start);
+
+/* Records the time thread @p ithr of a region spends in the parallel()
+ * functor. Cheap no-op if @p stats is nullptr. */
+struct thread_scope_t {
+    thread_scope_t(exec_stats_t *stats, int ithr) : stats_(stats) {
+        if (stats_) saved_ = thread_begin(stats_, ithr, start_);
+    }
+    ~thread_scope_t() {
+        if (stats_) thread_end(saved_, start_);
+    }
+
+private:
+    exec_stats_t *stats_;
+    thread_state_t saved_ {nullptr, -1};
+    double start_ = 0;
+
+    thread_scope_t(const thread_scope_t &) = delete;
+    thread_scope_t &operator=(const thread_scope_t &) = delete;
+};
+
+/* Records the time spent in an event (e.g. a barrier) by the calling thread.
+ * No-op if the thread does not belong to a profiled region. */
+struct event_scope_t {
+    event_scope_t(event_t event) : event_(event) {
+        stats_ = event_begin(ithr_, start_);
+    }
+    ~event_scope_t() {
+        if (stats_) event_end(stats_, ithr_, event_, start_);
+    }
+
+private:
+    event_t event_;
+    exec_stats_t *stats_;
+    int ithr_ = -1;
+    double start_ = 0;
+
+    event_scope_t(const event_scope_t &) = delete;
+    event_scope_t &operator=(const event_scope_t &) = delete;
+};
+
+/* Attaches per-execution statistics to the calling thread for the lifetime
+ * of the object and reports them at the end, if any region was recorded */
+struct exec_scope_t {
+    exec_scope_t(const char *pd_info);
+    ~exec_scope_t();
+
+private:
+    const char *pd_info_;
+    exec_stats_t *stats_;
+    thread_state_t saved_;
+
+    exec_scope_t(const exec_scope_t &) = delete;
+    exec_scope_t &operator=(const exec_scope_t &) = delete;
+};
+
+} // namespace thread_profiling
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -216,6 +216,8 @@ inline data_type_t default_accum_data_type(data_type_t src_dt,
         if ((src_dt == u8 || src_dt == s8) && wei_dt == s8
                 && one_of(dst_dt, f32, s32, s8, u8))
             return s32;
+        // f32 source is quantized dynamically to be used with s8 weights
+        if (src_dt == f32 && wei_dt == s8 && dst_dt == f32) return s32;
     } else if (prop_kind == backward_data) {
         if (one_of(src_dt, f32, s32, s8, u8) && wei_dt == s8
                 && one_of(dst_dt, s8, u8))
@@ -285,6 +285,8 @@ void flags2str(char *str, int len, int written, unsigned flags) {
     if (flags & dnnl_use_global_stats) s += "G";
     if (flags & dnnl_use_scaleshift) s += "S";
     if (flags & dnnl_fuse_norm_relu) s += "R";
+    if (flags & dnnl_fuse_add_norm) s += "A";
+    if (flags & dnnl_fuse_norm_add_relu) s += "D";
     DPRINT(str, len, written, "flags:%s", s.c_str());
 }
 
@@ -986,7 +988,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
 
 dnnl_status_t dnnl_set_verbose(int level) {
     using namespace dnnl::impl::status;
-    if (level < 0 || level > 2) return invalid_arguments;
+    if (level < 0 || level > 3) return invalid_arguments;
     dnnl::impl::verbose.set(level);
     return success;
 }
@@ -31,6 +31,7 @@
 #include "cpu/x64/gemm_bf16_convolution.hpp"
 #include "cpu/x64/jit_avx2_1x1_convolution.hpp"
 #include "cpu/x64/jit_avx2_convolution.hpp"
+#include "cpu/x64/jit_avx2_f32_wino_conv.hpp"
 #include "cpu/x64/jit_avx2_x8s8s32x_1x1_convolution.hpp"
 #include "cpu/x64/jit_avx2_x8s8s32x_convolution.hpp"
 #include "cpu/x64/jit_avx512_common_1x1_convolution.hpp"
@@ -89,6 +90,7 @@ static const std::map<conv_impl_key_t, std::vector<pd_create_f>> impl_list_map {
         CPU_INSTANCE_X64(jit_avx512_common_convolution_fwd_t<f32>)
         CPU_INSTANCE_X64(jit_avx2_dw_convolution_fwd_t)
         CPU_INSTANCE_X64(jit_avx2_1x1_convolution_fwd_t)
+        CPU_INSTANCE_X64(jit_avx2_f32_wino_conv_fwd_t)
         CPU_INSTANCE_X64(jit_sse41_dw_convolution_fwd_t)
         CPU_INSTANCE_X64(jit_sse41_1x1_convolution_fwd_t)
         CPU_INSTANCE_X64(jit_avx2_convolution_fwd_t)
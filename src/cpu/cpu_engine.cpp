@@ -29,7 +29,14 @@ namespace cpu {
 
 status_t cpu_engine_t::create_memory_storage(
         memory_storage_t **storage, unsigned flags, size_t size, void *handle) {
-    auto _storage = new cpu_memory_storage_t(this);
+    cpu_memory_storage_t *_storage = nullptr;
+    const auto placement = get_memory_placement();
+    if (has_user_allocator())
+        _storage = new cpu_memory_storage_t(this, allocator_);
+    else if (placement.flags != dnnl_cpu_memory_placement_default)
+        _storage = new cpu_memory_storage_t(this, placement);
+    else
+        _storage = new cpu_memory_storage_t(this);
     if (_storage == nullptr) return status::out_of_memory;
     status_t status = _storage->init(flags, size, handle);
     if (status != status::success) {
@@ -40,6 +47,17 @@ status_t cpu_engine_t::create_memory_storage(
     return status::success;
 }
 
+status_t cpu_engine_t::set_memory_placement(
+        const memory_placement::placement_t &placement) {
+    if (has_user_allocator()) return status::invalid_arguments;
+    status_t status = memory_placement::check(placement);
+    if (status != status::success) return status;
+
+    placement_flags_ = placement.flags;
+    placement_numa_node_ = placement.numa_node;
+    return status::success;
+}
+
 status_t cpu_engine_t::create_stream(
         stream_t **stream, unsigned flags, const stream_attr_t *attr) {
     return safe_ptr_assign<stream_t>(
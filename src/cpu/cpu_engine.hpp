@@ -18,12 +18,14 @@
 #define CPU_CPU_ENGINE_HPP
 
 #include <assert.h>
+#include <atomic>
 
 #include "dnnl.h"
 
 #include "common/c_types_map.hpp"
 #include "common/engine.hpp"
 
+#include "cpu/cpu_memory_placement.hpp"
 #include "cpu/platform.hpp"
 
 #define CPU_INSTANCE(...) &primitive_desc_t::create<__VA_ARGS__::pd_t>,
@@ -58,7 +60,31 @@ DECLARE_IMPL_LIST(softmax);
 class cpu_engine_t : public engine_t {
 public:
     cpu_engine_t()
-        : engine_t(engine_kind::cpu, get_default_runtime(engine_kind::cpu)) {}
+        : engine_t(engine_kind::cpu, get_default_runtime(engine_kind::cpu))
+        , allocator_ {nullptr, nullptr, nullptr}
+        , placement_flags_(dnnl_cpu_memory_placement_default)
+        , placement_numa_node_(0) {}
+
+    cpu_engine_t(const allocator_t &allocator)
+        : engine_t(engine_kind::cpu, get_default_runtime(engine_kind::cpu))
+        , allocator_(allocator)
+        , placement_flags_(dnnl_cpu_memory_placement_default)
+        , placement_numa_node_(0) {}
+
+    bool has_user_allocator() const override {
+        return allocator_.allocate != nullptr;
+    }
+
+    /** returns the user-provided allocator, valid only if
+     * has_user_allocator() returns true */
+    const allocator_t &allocator() const { return allocator_; }
+
+    /** sets the placement of the large buffers allocated after the call */
+    status_t set_memory_placement(
+            const memory_placement::placement_t &placement);
+    memory_placement::placement_t get_memory_placement() const {
+        return {placement_flags_, placement_numa_node_};
+    }
 
     /* implementation part */
     status_t create_memory_storage(memory_storage_t **storage, unsigned flags,
@@ -101,6 +127,11 @@ public:
         }
 #undef CASE
     }
+
+private:
+    allocator_t allocator_;
+    std::atomic<unsigned> placement_flags_;
+    std::atomic<int> placement_numa_node_;
 };
 
 class cpu_engine_factory_t : public engine_factory_t {
@@ -111,6 +142,12 @@ public:
         *engine = new cpu_engine_t();
         return status::success;
     };
+    status_t engine_create(engine_t **engine, size_t index,
+            const allocator_t &allocator) const {
+        assert(index == 0);
+        *engine = new cpu_engine_t(allocator);
+        return status::success;
+    };
 };
 
 } // namespace cpu
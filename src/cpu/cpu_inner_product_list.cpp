@@ -59,6 +59,7 @@ static const pd_create_f impl_list[] = {
         CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t<s8, s8>)
         CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t<s8, s32>)
         CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t<s8, f32>)
+        CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t<f32, f32>)
         CPU_INSTANCE(ref_inner_product_fwd_t<u8, s8, u8, s32>)
         CPU_INSTANCE(ref_inner_product_fwd_t<u8, s8, s8, s32>)
         CPU_INSTANCE(ref_inner_product_fwd_t<u8, s8, s32, s32>)
@@ -42,6 +42,7 @@ static const pd_create_f impl_list[] = {
         CPU_INSTANCE_X64(jit_uni_lrn_fwd_t<avx2>)
         CPU_INSTANCE_X64(jit_uni_lrn_bwd_t<avx2>)
         CPU_INSTANCE_X64(jit_uni_lrn_fwd_t<sse41>)
+        CPU_INSTANCE_X64(jit_uni_lrn_bwd_t<sse41>)
         CPU_INSTANCE(ref_lrn_fwd_t<f32>)
         CPU_INSTANCE(ref_lrn_bwd_t<f32>)
         CPU_INSTANCE(ref_lrn_fwd_t<bf16>)
@@ -0,0 +1,164 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <stdint.h>
+
+#include "common/memory_debug.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_memory_placement.hpp"
+#include "cpu/platform.hpp"
+
+// The NUMA policies are set with the raw system call to avoid a dependency
+// on libnuma. The values are from linux/mempolicy.h.
+#ifndef MPOL_BIND
+#define MPOL_BIND 2
+#endif
+#ifndef MPOL_INTERLEAVE
+#define MPOL_INTERLEAVE 3
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace memory_placement {
+
+namespace {
+enum {
+    max_numa_nodes = 64,
+    huge_page_size = PAGE_2M,
+};
+
+const unsigned all_flags = dnnl_cpu_memory_placement_huge_pages
+        | dnnl_cpu_memory_placement_numa_interleave
+        | dnnl_cpu_memory_placement_numa_bind;
+
+#ifdef __linux__
+void *map(size_t size, bool huge_pages) {
+    if (huge_pages) {
+#ifdef MAP_HUGETLB
+        // Explicitly reserved huge pages, if any
+        void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED) return ptr;
+#endif
+    }
+
+    // Over-allocate by a huge page and trim the mapping, so that the buffer
+    // is aligned to the huge page size and can be backed by transparent huge
+    // pages
+    const size_t map_size = size + huge_page_size;
+    void *ptr = mmap(nullptr, map_size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) return nullptr;
+
+    char *start = (char *)ptr;
+    char *aligned = utils::align_ptr(start, (size_t)huge_page_size);
+    char *end = start + map_size;
+    if (aligned != start) munmap(start, aligned - start);
+    if (aligned + size != end) munmap(aligned + size, end - aligned - size);
+
+#ifdef MADV_HUGEPAGE
+    if (huge_pages) madvise(aligned, size, MADV_HUGEPAGE);
+#endif
+    return aligned;
+}
+
+void bind(void *ptr, size_t size, const placement_t &placement) {
+    unsigned long mask = 0;
+    int mode = 0;
+    if (placement.flags & dnnl_cpu_memory_placement_numa_interleave) {
+        mode = MPOL_INTERLEAVE;
+        mask = ~0UL; // the kernel drops the nodes without memory
+    } else if (placement.flags & dnnl_cpu_memory_placement_numa_bind) {
+        mode = MPOL_BIND;
+        mask = 1UL << placement.numa_node;
+    } else {
+        return;
+    }
+
+    // Best effort: the pages are placed by the default policy on failure
+    const unsigned long maxnode = max_numa_nodes + 1;
+    syscall(SYS_mbind, ptr, size, mode, &mask, maxnode, 0);
+}
+#endif
+} // namespace
+
+bool is_supported() {
+#ifdef __linux__
+    return true;
+#else
+    return false;
+#endif
+}
+
+status_t check(const placement_t &placement) {
+    if (placement.flags & ~all_flags) return status::invalid_arguments;
+
+    const unsigned numa_flags = dnnl_cpu_memory_placement_numa_interleave
+            | dnnl_cpu_memory_placement_numa_bind;
+    if ((placement.flags & numa_flags) == numa_flags)
+        return status::invalid_arguments;
+
+    if ((placement.flags & dnnl_cpu_memory_placement_numa_bind)
+            && (placement.numa_node < 0
+                    || placement.numa_node >= max_numa_nodes))
+        return status::invalid_arguments;
+
+    if (placement.flags != dnnl_cpu_memory_placement_default && !is_supported())
+        return status::unimplemented;
+
+    return status::success;
+}
+
+bool is_applicable(const placement_t &placement, size_t size) {
+    // The memory debug mode relies on its own allocation to protect buffers
+    return is_supported()
+            && placement.flags != dnnl_cpu_memory_placement_default
+            && size >= (size_t)huge_page_size && !memory_debug::is_mem_debug();
+}
+
+void *allocate(const placement_t &placement, size_t size) {
+#ifdef __linux__
+    size = utils::rnd_up(size, (size_t)huge_page_size);
+    const bool huge_pages
+            = placement.flags & dnnl_cpu_memory_placement_huge_pages;
+    void *ptr = map(size, huge_pages);
+    if (ptr) bind(ptr, size, placement);
+    return ptr;
+#else
+    return nullptr;
+#endif
+}
+
+void deallocate(void *ptr, size_t size) {
+#ifdef __linux__
+    if (ptr) munmap(ptr, utils::rnd_up(size, (size_t)huge_page_size));
+#endif
+}
+
+} // namespace memory_placement
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_MEMORY_PLACEMENT_HPP
+#define CPU_CPU_MEMORY_PLACEMENT_HPP
+
+#include <stddef.h>
+
+#include "dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace memory_placement {
+
+/* Placement of the large buffers allocated by a CPU engine.
+ *
+ * Huge pages and NUMA policies only make sense for buffers that span at
+ * least one huge page, so the smaller buffers keep using the regular
+ * aligned allocation. Every policy is applied on a best effort basis: if the
+ * system does not support it (no huge pages reserved, THP disabled, a single
+ * NUMA node, ...) the buffer silently falls back to the default placement. */
+struct placement_t {
+    unsigned flags; // dnnl_cpu_memory_placement_flags_t
+    int numa_node; // used with dnnl_cpu_memory_placement_numa_bind only
+};
+
+/** returns true if the placement is supported by the system */
+bool is_supported();
+
+/** returns status::success if the placement is valid */
+status_t check(const placement_t &placement);
+
+/** returns true if a buffer of @p size bytes is allocated with the placement
+ * allocator */
+bool is_applicable(const placement_t &placement, size_t size);
+
+/** allocates @p size bytes according to @p placement, returns nullptr on
+ * failure. The pointer is aligned at least to the page size. */
+void *allocate(const placement_t &placement, size_t size);
+
+/** frees a buffer returned by allocate() */
+void deallocate(void *ptr, size_t size);
+
+} // namespace memory_placement
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -17,6 +17,7 @@
 #ifndef CPU_CPU_MEMORY_STORAGE_HPP
 #define CPU_CPU_MEMORY_STORAGE_HPP
 
+#include <functional>
 #include <memory>
 
 #include "common/c_types_map.hpp"
@@ -24,6 +25,7 @@
 #include "common/memory_storage.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_memory_placement.hpp"
 #include "cpu/platform.hpp"
 
 namespace dnnl {
@@ -33,7 +35,25 @@ namespace cpu {
 class cpu_memory_storage_t : public memory_storage_t {
 public:
     cpu_memory_storage_t(engine_t *engine)
-        : memory_storage_t(engine), data_(nullptr, release) {}
+        : memory_storage_t(engine)
+        , allocator_ {nullptr, nullptr, nullptr}
+        , placement_ {dnnl_cpu_memory_placement_default, 0}
+        , data_(nullptr, release) {}
+
+    /* the storage allocates its buffer with the user-provided allocator */
+    cpu_memory_storage_t(engine_t *engine, const allocator_t &allocator)
+        : memory_storage_t(engine)
+        , allocator_(allocator)
+        , placement_ {dnnl_cpu_memory_placement_default, 0}
+        , data_(nullptr, release) {}
+
+    /* the storage places a large buffer according to the placement */
+    cpu_memory_storage_t(
+            engine_t *engine, const memory_placement::placement_t &placement)
+        : memory_storage_t(engine)
+        , allocator_ {nullptr, nullptr, nullptr}
+        , placement_(placement)
+        , data_(nullptr, release) {}
 
     status_t get_data_handle(void **handle) const override {
         *handle = data_.get();
@@ -55,14 +75,40 @@ public:
 
 protected:
     status_t init_allocate(size_t size) override {
-        void *ptr = malloc(size, platform::get_cache_line_size());
+        const size_t alignment = platform::get_cache_line_size();
+        if (allocator_.allocate) {
+            void *ptr = allocator_.allocate(
+                    size, alignment, allocator_.user_data);
+            if (!ptr) return status::out_of_memory;
+            // The size is kept for the sized deallocation
+            const allocator_t allocator = allocator_;
+            data_ = decltype(data_)(ptr, [allocator, size](void *ptr) {
+                allocator.free(ptr, size, allocator.user_data);
+            });
+            return status::success;
+        }
+
+        if (memory_placement::is_applicable(placement_, size)) {
+            // Fall back to the default allocation if the placement fails
+            void *ptr = memory_placement::allocate(placement_, size);
+            if (ptr) {
+                data_ = decltype(data_)(ptr, [size](void *ptr) {
+                    memory_placement::deallocate(ptr, size);
+                });
+                return status::success;
+            }
+        }
+
+        void *ptr = malloc(size, alignment);
         if (!ptr) return status::out_of_memory;
         data_ = decltype(data_)(ptr, destroy);
         return status::success;
     }
 
 private:
-    std::unique_ptr<void, void (*)(void *)> data_;
+    allocator_t allocator_;
+    memory_placement::placement_t placement_;
+    std::unique_ptr<void, std::function<void(void *)>> data_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_memory_storage_t);
 
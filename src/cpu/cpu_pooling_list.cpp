@@ -16,6 +16,7 @@
 
 #include "cpu/cpu_engine.hpp"
 
+#include "cpu/global_pooling.hpp"
 #include "cpu/nchw_pooling.hpp"
 #include "cpu/nhwc_pooling.hpp"
 #include "cpu/ref_pooling.hpp"
@@ -38,10 +39,14 @@ using namespace dnnl::impl::data_type;
 // clang-format off
 static const pd_create_f impl_list[] = {
         /* fp */
+        CPU_INSTANCE(global_pooling_fwd_t<bf16>)
+        CPU_INSTANCE(global_pooling_fwd_t<f32>)
         CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx512_core, bf16>)
         CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<avx512_core, bf16>)
         CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx512_common, f32>)
         CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<avx512_common, f32>)
+        CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx, bf16>)
+        CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<avx, bf16>)
         CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<avx, f32>)
         CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<avx, f32>)
         CPU_INSTANCE_X64(jit_uni_pooling_fwd_t<sse41, f32>)
@@ -64,7 +69,11 @@ static const pd_create_f impl_list[] = {
         CPU_INSTANCE(ref_pooling_fwd_t<s32>)
         CPU_INSTANCE(ref_pooling_fwd_t<s8, s32>)
         CPU_INSTANCE(ref_pooling_fwd_t<u8, s32>)
+        CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<avx, s8>)
+        CPU_INSTANCE_X64(jit_uni_pooling_bwd_t<avx, u8>)
         CPU_INSTANCE(ref_pooling_bwd_t<s32>)
+        CPU_INSTANCE(ref_pooling_bwd_t<s8>)
+        CPU_INSTANCE(ref_pooling_bwd_t<u8>)
         /* eol */
         nullptr,
 };
@@ -21,6 +21,7 @@
 
 #if DNNL_X64
 #include "cpu/x64/jit_avx512_common_resampling.hpp"
+#include "cpu/x64/jit_uni_resampling.hpp"
 using namespace dnnl::impl::cpu::x64;
 #endif
 
@@ -39,8 +40,18 @@ static const pd_create_f impl_list[] = {
         CPU_INSTANCE_X64(jit_avx512_common_resampling_fwd_t<bf16>)
         CPU_INSTANCE_X64(jit_avx512_common_resampling_bwd_t<f32>)
         CPU_INSTANCE_X64(jit_avx512_common_resampling_bwd_t<bf16>)
+        CPU_INSTANCE_X64(jit_uni_resampling_fwd_t<avx2>)
+        CPU_INSTANCE_X64(jit_uni_resampling_fwd_t<sse41>)
         CPU_INSTANCE(simple_resampling_fwd_t<f32>)
         CPU_INSTANCE(simple_resampling_fwd_t<bf16>)
+        CPU_INSTANCE(simple_resampling_fwd_t<f32, s8>)
+        CPU_INSTANCE(simple_resampling_fwd_t<f32, u8>)
+        CPU_INSTANCE(simple_resampling_fwd_t<s8, f32>)
+        CPU_INSTANCE(simple_resampling_fwd_t<s8, s8>)
+        CPU_INSTANCE(simple_resampling_fwd_t<s8, u8>)
+        CPU_INSTANCE(simple_resampling_fwd_t<u8, f32>)
+        CPU_INSTANCE(simple_resampling_fwd_t<u8, s8>)
+        CPU_INSTANCE(simple_resampling_fwd_t<u8, u8>)
         CPU_INSTANCE(simple_resampling_bwd_t<f32>)
         CPU_INSTANCE(simple_resampling_bwd_t<bf16>)
         CPU_INSTANCE(ref_resampling_fwd_t<f32>)
@@ -27,6 +27,23 @@ namespace cpu {
 
 struct cpu_resampling_fwd_pd_t : public resampling_fwd_pd_t {
     using resampling_fwd_pd_t::resampling_fwd_pd_t;
+
+protected:
+    /* the common output scale and any sequence of sum and eltwise post-ops,
+     * applied to the interpolated value in f32 before the conversion to the
+     * destination data type */
+    bool attr_ok() const {
+        using skip_mask_t = primitive_attr_t::skip_mask_t;
+        const auto &po = attr()->post_ops_;
+        bool ok = attr()->has_default_values(
+                          skip_mask_t::oscale | skip_mask_t::post_ops)
+                && attr()->output_scales_.mask_ == 0
+                && attr()->output_scales_.defined();
+        for (int idx = 0; idx < po.len_; idx++)
+            ok = ok && (po.entry_[idx].is_sum(false)
+                        || po.entry_[idx].is_eltwise());
+        return ok;
+    }
 };
 
 struct cpu_resampling_bwd_pd_t : public resampling_bwd_pd_t {
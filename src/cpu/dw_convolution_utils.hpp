@@ -23,6 +23,8 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/platform.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -63,15 +65,22 @@ inline status_t get_depthwise_conv_desc(convolution_desc_t &cd_dw,
     const auto g = src_dw_d.dims()[1];
     const auto ih = src_dw_d.dims()[ndims - 2];
     const auto iw = src_dw_d.dims()[ndims - 1];
+    const auto kernel = dw_po.kernel;
     const auto stride = dw_po.stride;
+    const auto padding = dw_po.padding;
+
+    const dims_t weights_tz = {g, 1, 1, kernel, kernel};
 
-    const dims_t weights_tz = {g, 1, 1, 3, 3};
+    // the padding is symmetric, so that the output spatial size is the one of
+    // a regular convolution
+    const auto oh = (ih + 2 * padding - kernel) / stride + 1;
+    const auto ow = (iw + 2 * padding - kernel) / stride + 1;
+    if (oh <= 0 || ow <= 0) return status::unimplemented;
 
-    const dims_t dst_tz
-            = {n, oc, utils::div_up(ih, stride), utils::div_up(iw, stride)};
+    const dims_t dst_tz = {n, oc, oh, ow};
 
     const dims_t bias_tz = {oc};
-    const dims_t pad_tz = {1, 1};
+    const dims_t pad_tz = {padding, padding};
     const dims_t stride_tz = {stride, stride};
 
     memory_desc_t src_md, weights_md, bias_md, dst_md;
@@ -97,6 +106,27 @@ inline status_t get_depthwise_conv_desc(convolution_desc_t &cd_dw,
     return status::success;
 }
 
+// Returns the number of the output channel blocks of a 1x1 convolution that
+// are computed at once for the fused depthwise convolution. The number has to
+// divide nb_load, as the drivers do not support a tail, and is reduced further
+// until the per thread buffer with kh rows of the 1x1 convolution output,
+// which takes row_block_size bytes per output channel block, fits in half of
+// L2. The rows are then read by the depthwise convolution straight from L2,
+// while the other half is left for the weights and the source data.
+inline int get_dw_conv_load_blocking(
+        int nb_load, int nb_load_blocking, size_t row_block_size) {
+    const size_t l2_size = platform::get_per_core_cache_size(2) / 2;
+    int blocking = nstl::max(1, nstl::min(nb_load, nb_load_blocking));
+    while (nb_load % blocking != 0)
+        --blocking;
+    while (blocking > 1 && blocking * row_block_size > l2_size) {
+        do {
+            --blocking;
+        } while (nb_load % blocking != 0);
+    }
+    return blocking;
+}
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
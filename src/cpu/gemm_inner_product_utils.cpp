@@ -14,9 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <math.h>
+
 #include <memory>
 
+#include "common/dnnl_thread.hpp"
 #include "common/math_utils.hpp"
+#include "common/nstl.hpp"
 #include "cpu/simple_q10n.hpp"
 
 #include "cpu/ref_eltwise.hpp"
@@ -117,6 +121,26 @@ pp_kernel_t<acc_type, dst_type> *pp_kernel_t<acc_type, dst_type>::create(
             OC, MB, attr, bias_dt, skip_sum);
 }
 
+float quantize_src_row(
+        const float *src, dim_t len, dim_t stride, int8_t *dst) {
+    float max_abs = 0.f;
+    for (dim_t i = 0; i < len; ++i)
+        max_abs = nstl::max(max_abs, ::fabsf(src[i * stride]));
+
+    // a row of zeros is quantized to zeros with any scale
+    const float inv_scale = max_abs > 0.f ? 127.f / max_abs : 0.f;
+    if (stride == 1) {
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < len; ++i)
+            dst[i] = qz_a1b0<float, int8_t>()(src[i] * inv_scale);
+    } else {
+        for (dim_t i = 0; i < len; ++i)
+            dst[i] = qz_a1b0<float, int8_t>()(src[i * stride] * inv_scale);
+    }
+
+    return max_abs / 127.f;
+}
+
 using namespace data_type;
 template struct pp_kernel_t<f32, f32>;
 template struct pp_kernel_t<s32, f32>;
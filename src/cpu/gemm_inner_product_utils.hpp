@@ -73,6 +73,12 @@ protected:
     bool runtime_mb() const { return MB_ == (size_t)DNNL_RUNTIME_DIM_VAL; }
 };
 
+// Quantizes a row of the f32 source to s8 with a symmetric scale computed
+// from the data: dst[i] = round(src[i * stride] / scale), where
+// scale = max|src| / 127. Returns the scale that dequantizes the row.
+float quantize_src_row(
+        const float *src, dim_t len, dim_t stride, int8_t *dst);
+
 } // namespace inner_product_utils
 } // namespace cpu
 } // namespace impl
@@ -16,6 +16,7 @@
 
 #include "common/dnnl_thread.hpp"
 #include "common/math_utils.hpp"
+#include "cpu/cpu_primitive.hpp"
 #include "cpu/simple_q10n.hpp"
 
 #include "cpu/gemm/gemm.hpp"
@@ -47,30 +48,59 @@ status_t gemm_x8s8s32x_inner_product_fwd_t<src_type, dst_type>::execute_forward(
     const dim_t N = MB;
     const dim_t K = pd()->IC_total_padded();
     const int8_t off_a = 0;
-    const src_data_t off_b = 0;
+    const gemm_src_data_t off_b = 0;
     const int32_t off_c = 0;
 
-    const float *scales = pd()->attr()->output_scales_.scales_;
+    DEFINE_SCALES_BUFFER(scales);
 
+    const auto scratchpad = ctx.get_scratchpad_grantor();
     acc_data_t *acc = pd()->dst_is_acc_
             ? (acc_data_t *)dst
-            : ctx.get_scratchpad_grantor().template get<acc_data_t>(
-                    key_iprod_int_dat_in_acc_dt);
+            : scratchpad.template get<acc_data_t>(key_iprod_int_dat_in_acc_dt);
+
+    const gemm_src_data_t *gemm_src = (const gemm_src_data_t *)src;
+    float *src_scales = nullptr;
+    if (is_dynamic_quantization) {
+        auto src_q = scratchpad.template get<int8_t>(key_iprod_src_quantized);
+        src_scales = scratchpad.template get<float>(key_iprod_src_scales);
+        parallel_nd(MB, [&](dim_t mb) {
+            src_scales[mb] = inner_product_utils::quantize_src_row(
+                    (const float *)src + mb * K, K, 1, src_q + mb * K);
+        });
+        gemm_src = (const gemm_src_data_t *)src_q;
+    }
 
     const float onef = 1.0, zerof = 0.0;
     status_t st = gemm_s8x8s32(wei_tr ? "T" : "N", "N", "F", &M, &N, &K, &onef,
-            weights, wei_tr ? &K : &M, &off_a, src, &K, &off_b, &zerof, acc, &M,
-            &off_c);
+            weights, wei_tr ? &K : &M, &off_a, gemm_src, &K, &off_b, &zerof,
+            acc, &M, &off_c);
     if (st != status::success) return st;
 
-    if (!pd()->attr()->has_default_values() || dst_type != data_type::s32
-            || pd()->with_bias()) {
+    if (is_dynamic_quantization) {
+        // the accumulators of a row are converted to f32 in place right
+        // before the post-processing of the row, while they are in cache
+        float *acc_f32 = (float *)acc;
+        parallel(0, [&](int ithr, int nthr) {
+            dim_t mb_start {0}, mb_end {0};
+            balance211(MB, nthr, ithr, mb_start, mb_end);
+            for (dim_t mb = mb_start; mb < mb_end; ++mb) {
+                const float s = src_scales[mb];
+                PRAGMA_OMP_SIMD()
+                for (dim_t oc = 0; oc < OC; ++oc)
+                    acc_f32[mb * OC + oc] = s * acc[mb * OC + oc];
+                (*pp_kernel_)(dst, (const pp_acc_data_t *)acc, bias, scales,
+                        mb * OC, (mb + 1) * OC, 0, nullptr);
+            }
+        });
+    } else if (!pd()->attr()->has_default_values()
+            || dst_type != data_type::s32 || pd()->with_bias()) {
         const bool force_sequential
                 = pp_kernel_->sequential_kernel() || MB * OC < 2000;
         parallel(force_sequential ? 1 : 0, [&](int ithr, int nthr) {
             size_t start, end;
             balance211((size_t)(OC * MB), nthr, ithr, start, end);
-            (*pp_kernel_)(dst, acc, bias, scales, start, end, 0, nullptr);
+            (*pp_kernel_)(dst, (const pp_acc_data_t *)acc, bias, scales, start,
+                    end, 0, nullptr);
         });
     }
 
@@ -87,6 +117,7 @@ template struct gemm_x8s8s32x_inner_product_fwd_t<s8, f32>;
 template struct gemm_x8s8s32x_inner_product_fwd_t<s8, s32>;
 template struct gemm_x8s8s32x_inner_product_fwd_t<s8, s8>;
 template struct gemm_x8s8s32x_inner_product_fwd_t<s8, u8>;
+template struct gemm_x8s8s32x_inner_product_fwd_t<f32, f32>;
 
 } // namespace cpu
 } // namespace impl
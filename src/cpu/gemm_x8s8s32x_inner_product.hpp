@@ -56,7 +56,7 @@ struct gemm_x8s8s32x_inner_product_fwd_t : public primitive_t {
                             utils::one_of(
                                     weights_md(1)->data_type, f32, s32, s8, u8))
                     && attr()->has_default_values(
-                            primitive_attr_t::skip_mask_t::oscale
+                            primitive_attr_t::skip_mask_t::oscale_runtime
                             | primitive_attr_t::skip_mask_t::post_ops)
                     && output_scales_mask_ok() && post_ops_ok()
                     && set_default_params() == status::success
@@ -96,11 +96,15 @@ struct gemm_x8s8s32x_inner_product_fwd_t : public primitive_t {
 
     private:
         void init_scratchpad() {
-            if (!dst_is_acc_) {
-                auto scratchpad = scratchpad_registry().registrar();
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            if (!dst_is_acc_)
                 scratchpad.template book<acc_data_t>(
-                        memory_tracking::names::key_iprod_int_dat_in_acc_dt,
-                        MB() * OC());
+                        key_iprod_int_dat_in_acc_dt, MB() * OC());
+            if (is_dynamic_quantization) {
+                scratchpad.template book<int8_t>(
+                        key_iprod_src_quantized, MB() * IC_total_padded());
+                scratchpad.template book<float>(key_iprod_src_scales, MB());
             }
         }
     };
@@ -116,6 +120,14 @@ struct gemm_x8s8s32x_inner_product_fwd_t : public primitive_t {
     typedef typename prec_traits<dst_type>::type dst_data_t;
     typedef typename prec_traits<data_type::s32>::type acc_data_t;
 
+    // The f32 source is quantized to s8 on the fly with a scale per row
+    // (a minibatch sample) and the accumulators are dequantized back to f32
+    // before the post-processing kernel.
+    static constexpr bool is_dynamic_quantization = src_type == data_type::f32;
+    typedef typename prec_traits<is_dynamic_quantization
+                    ? data_type::s8
+                    : src_type>::type gemm_src_data_t;
+
     status_t execute(const exec_ctx_t &ctx) const override {
         return execute_forward(ctx);
     }
@@ -124,8 +136,10 @@ private:
     status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
-    using pp_kernel_t
-            = inner_product_utils::pp_kernel_t<data_type::s32, dst_type>;
+    using pp_kernel_t = inner_product_utils::pp_kernel_t<
+            is_dynamic_quantization ? data_type::f32 : data_type::s32,
+            dst_type>;
+    typedef typename pp_kernel_t::acc_data_t pp_acc_data_t;
     std::unique_ptr<pp_kernel_t> pp_kernel_;
 };
 
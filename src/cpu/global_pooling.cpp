@@ -0,0 +1,274 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/global_pooling.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace memory_tracking::names;
+
+namespace {
+enum {
+    // the channels of a task fit a vector register on avx512
+    max_c_chunk = 16,
+    // the minimal number of elements reduced by a thread when the spatial
+    // domain is split
+    min_part_size = 1024,
+};
+} // namespace
+
+template <data_type_t d_type>
+status_t global_pooling_fwd_t<d_type>::pd_t::init(engine_t *engine) {
+    using namespace alg_kind;
+    using namespace format_tag;
+
+    bool ok = is_fwd()
+            && utils::one_of(desc()->alg_kind, pooling_max,
+                    pooling_avg_include_padding, pooling_avg_exclude_padding)
+            && utils::everyone_is(
+                    d_type, src_md()->data_type, dst_md()->data_type)
+            && platform::has_data_type_support(d_type)
+            && set_default_params() == status::success
+            && attr()->has_default_values() && is_global();
+    if (!ok) return status::unimplemented;
+
+    const int sp_idx = ndims() - 3;
+    const auto tag = memory_desc_matches_one_of_tag(*src_md(),
+            utils::pick(sp_idx, ncw, nchw, ncdhw),
+            utils::pick(sp_idx, nwc, nhwc, ndhwc),
+            utils::pick(sp_idx, nCw8c, nChw8c, nCdhw8c),
+            utils::pick(sp_idx, nCw16c, nChw16c, nCdhw16c));
+    if (tag == format_tag::undef || !memory_desc_matches_tag(*dst_md(), tag))
+        return status::unimplemented;
+
+    const memory_desc_wrapper src_d(src_md());
+    const auto &bd = src_d.blocking_desc();
+    if (bd.inner_nblks == 1) {
+        c_chunk_ = bd.inner_blks[0];
+        nb_c_chunks_ = src_d.padded_dims()[1] / c_chunk_;
+    } else {
+        // the channels are contiguous for the channels last layout only
+        c_chunk_ = bd.strides[1] == 1 ? nstl::min(C(), (dim_t)max_c_chunk)
+                                      : 1;
+        nb_c_chunks_ = utils::div_up(C(), c_chunk_);
+    }
+
+    const bool is_training = desc_.prop_kind == prop_kind::forward_training;
+    if (desc()->alg_kind == pooling_max && is_training) init_default_ws();
+
+    init_split();
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <data_type_t d_type>
+bool global_pooling_fwd_t<d_type>::pd_t::is_global() const {
+    return KD() == ID() && KH() == IH() && KW() == IW()
+            && OD() * OH() * OW() == 1 && padFront() == 0 && padBack() == 0
+            && padT() == 0 && padB() == 0 && padL() == 0 && padR() == 0;
+}
+
+template <data_type_t d_type>
+void global_pooling_fwd_t<d_type>::pd_t::init_split() {
+    const dim_t SP = ID() * IH() * IW();
+    const dim_t ntasks = MB() * nb_c_chunks_;
+    const int nthr = dnnl_get_max_threads();
+
+    nsp_chunks_ = 1;
+    if (ntasks < nthr) {
+        const dim_t min_sp_chunk = utils::div_up(min_part_size, c_chunk_);
+        nsp_chunks_ = nstl::min(
+                nthr / ntasks, utils::div_up(SP, min_sp_chunk));
+        nsp_chunks_ = nstl::max(nsp_chunks_, (dim_t)1);
+    }
+    sp_chunk_ = utils::div_up(SP, nsp_chunks_);
+    nsp_chunks_ = utils::div_up(SP, sp_chunk_);
+}
+
+template <data_type_t d_type>
+void global_pooling_fwd_t<d_type>::pd_t::init_scratchpad() {
+    if (nsp_chunks_ == 1) return;
+
+    const size_t size = MB() * nb_c_chunks_ * nsp_chunks_ * c_chunk_;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(key_pool_reduction, size);
+    if (desc()->alg_kind == alg_kind::pooling_max)
+        scratchpad.template book<int>(key_pool_ind_reduction, size);
+}
+
+template <data_type_t d_type>
+void global_pooling_fwd_t<d_type>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    auto ws = CTX_OUT_MEM(unsigned char *, DNNL_ARG_WORKSPACE);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper ws_d(pd()->workspace_md());
+    const data_type_t ws_dt = ws ? ws_d.data_type() : data_type::undef;
+
+    const bool is_max = pd()->desc()->alg_kind == alg_kind::pooling_max;
+    const bool is_blocked = src_d.blocking_desc().inner_nblks > 0;
+
+    const dim_t MB = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t SP = pd()->ID() * pd()->IH() * pd()->IW();
+    const dim_t sp_stride = src_d.blocking_desc().strides[pd()->ndims() - 1];
+
+    const dim_t c_chunk = pd()->c_chunk();
+    const dim_t nb_c_chunks = pd()->nb_c_chunks();
+    const dim_t nsp_chunks = pd()->nsp_chunks();
+    const dim_t sp_chunk = pd()->sp_chunk();
+
+    // the padded channels of the blocked layouts are processed as well
+    auto chunk_len = [&](dim_t cb) {
+        return is_blocked ? c_chunk : nstl::min(c_chunk, C - cb * c_chunk);
+    };
+    // the blocked layouts are addressed by the index of the block
+    auto chunk_off = [&](dim_t cb) { return is_blocked ? cb : cb * c_chunk; };
+
+    auto reduce = [&](dim_t n, dim_t cb, dim_t isp, float *acc, int *idx) {
+        const dim_t len = chunk_len(cb);
+        const dim_t sp_s = isp * sp_chunk;
+        const dim_t sp_e = nstl::min(SP, sp_s + sp_chunk);
+        const data_t *s = &src[src_d.blk_off(n, chunk_off(cb))];
+
+        if (is_max) {
+            for (dim_t c = 0; c < len; ++c) {
+                acc[c] = nstl::numeric_limits<float>::lowest();
+                idx[c] = (int)sp_s;
+            }
+            for (dim_t sp = sp_s; sp < sp_e; ++sp) {
+                const data_t *p = &s[sp * sp_stride];
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < len; ++c) {
+                    const float v = p[c];
+                    const bool gt = v > acc[c];
+                    acc[c] = gt ? v : acc[c];
+                    idx[c] = gt ? (int)sp : idx[c];
+                }
+            }
+        } else if (len == 1) {
+            // plain layout: the spatial domain of a channel is contiguous
+            float sum = 0;
+            PRAGMA_OMP_SIMD(reduction(+ : sum))
+            for (dim_t sp = sp_s; sp < sp_e; ++sp)
+                sum += (float)s[sp * sp_stride];
+            acc[0] = sum;
+        } else {
+            for (dim_t c = 0; c < len; ++c)
+                acc[c] = 0;
+            for (dim_t sp = sp_s; sp < sp_e; ++sp) {
+                const data_t *p = &s[sp * sp_stride];
+                PRAGMA_OMP_SIMD()
+                for (dim_t c = 0; c < len; ++c)
+                    acc[c] += (float)p[c];
+            }
+        }
+    };
+
+    auto finalize = [&](dim_t n, dim_t cb, const float *acc, const int *idx) {
+        const dim_t len = chunk_len(cb);
+        data_t *d = &dst[dst_d.blk_off(n, chunk_off(cb))];
+        for (dim_t c = 0; c < len; ++c)
+            d[c] = is_max ? acc[c] : acc[c] / SP;
+
+        if (!ws) return;
+        const dim_t ws_off = ws_d.blk_off(n, chunk_off(cb));
+        for (dim_t c = 0; c < len; ++c) {
+            if (ws_dt == data_type::u8) {
+                assert(0 <= idx[c] && idx[c] <= 255);
+                ws[ws_off + c] = (unsigned char)idx[c];
+            } else {
+                reinterpret_cast<int *>(ws)[ws_off + c] = idx[c];
+            }
+        }
+    };
+
+    if (nsp_chunks == 1) {
+        parallel_nd(MB, nb_c_chunks, [&](dim_t n, dim_t cb) {
+            float acc[max_c_chunk];
+            int idx[max_c_chunk];
+            reduce(n, cb, 0, acc, idx);
+            finalize(n, cb, acc, idx);
+        });
+        return;
+    }
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *partial = scratchpad.template get<float>(key_pool_reduction);
+    int *partial_idx = is_max
+            ? scratchpad.template get<int>(key_pool_ind_reduction)
+            : nullptr;
+
+    auto part_off = [&](dim_t n, dim_t cb, dim_t isp) {
+        return ((n * nb_c_chunks + cb) * nsp_chunks + isp) * c_chunk;
+    };
+
+    parallel_nd(MB, nb_c_chunks, nsp_chunks,
+            [&](dim_t n, dim_t cb, dim_t isp) {
+                const dim_t off = part_off(n, cb, isp);
+                reduce(n, cb, isp, &partial[off],
+                        is_max ? &partial_idx[off] : nullptr);
+            });
+
+    // the parts are combined in order, so that the first maximum wins
+    parallel_nd(MB, nb_c_chunks, [&](dim_t n, dim_t cb) {
+        const dim_t len = chunk_len(cb);
+        const dim_t off = part_off(n, cb, 0);
+        float *acc = &partial[off];
+        int *idx = is_max ? &partial_idx[off] : nullptr;
+        for (dim_t isp = 1; isp < nsp_chunks; ++isp) {
+            const dim_t p_off = part_off(n, cb, isp);
+            const float *p = &partial[p_off];
+            if (is_max) {
+                const int *p_idx = &partial_idx[p_off];
+                for (dim_t c = 0; c < len; ++c) {
+                    if (p[c] > acc[c]) {
+                        acc[c] = p[c];
+                        idx[c] = p_idx[c];
+                    }
+                }
+            } else {
+                for (dim_t c = 0; c < len; ++c)
+                    acc[c] += p[c];
+            }
+        }
+        finalize(n, cb, acc, idx);
+    });
+}
+
+template struct global_pooling_fwd_t<data_type::f32>;
+template struct global_pooling_fwd_t<data_type::bf16>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
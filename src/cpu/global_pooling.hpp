@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_GLOBAL_POOLING_HPP
+#define CPU_GLOBAL_POOLING_HPP
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_pooling_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* Forward pooling with the kernel covering the whole spatial domain.
+ *
+ * The work is split over the minibatch and the chunks of channels that are
+ * contiguous in memory. When there are fewer such tasks than threads, the
+ * spatial reduction of a task is split as well: every thread reduces a part
+ * of the spatial domain into the scratchpad and the partial results are
+ * combined in order afterwards, so that max pooling reports the first
+ * maximum as the generic implementations do. */
+template <data_type_t d_type>
+struct global_pooling_fwd_t : public primitive_t {
+    struct pd_t : public cpu_pooling_fwd_pd_t {
+        using cpu_pooling_fwd_pd_t::cpu_pooling_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("simple_global:any", global_pooling_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // number of the contiguous channels reduced by a task
+        dim_t c_chunk() const { return c_chunk_; }
+        dim_t nb_c_chunks() const { return nb_c_chunks_; }
+        // number of the parts the spatial domain of a task is split into
+        dim_t nsp_chunks() const { return nsp_chunks_; }
+        dim_t sp_chunk() const { return sp_chunk_; }
+
+    private:
+        bool is_global() const;
+        void init_split();
+        void init_scratchpad();
+
+        dim_t c_chunk_ = 1;
+        dim_t nb_c_chunks_ = 1;
+        dim_t nsp_chunks_ = 1;
+        dim_t sp_chunk_ = 1;
+    };
+
+    global_pooling_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    typedef typename prec_traits<d_type>::type data_t;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
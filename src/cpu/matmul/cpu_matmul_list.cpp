@@ -43,6 +43,7 @@ static const pd_create_f impl_list[] = {
         INSTANCE(matmul::gemm_x8s8s32x_matmul_t<u8, s8, s32>),
         INSTANCE(matmul::gemm_x8s8s32x_matmul_t<u8, s8, s8>),
         INSTANCE(matmul::gemm_x8s8s32x_matmul_t<u8, s8, u8>),
+        INSTANCE(matmul::gemm_x8s8s32x_matmul_t<f32, s8, f32>),
         INSTANCE(matmul::ref_matmul_t<f32>),
         INSTANCE(matmul::ref_matmul_t<bf16, bf16, f32, f32>),
         INSTANCE(matmul::ref_matmul_t<bf16, bf16, bf16, f32>),
@@ -88,6 +88,13 @@ status_t gemm_x8s8s32x_matmul_t<src_type, weights_type, dst_type>::pd_t::init(
             && check_attr_oscale() && check_attr_post_ops();
     if (!ok) return status::unimplemented;
 
+    // the quantized source is kept in the scratchpad and the zero points
+    // make no sense for it
+    if (is_dynamic_quantization
+            && (!attr()->zero_points_.has_default_values()
+                    || utils::one_of(DNNL_RUNTIME_DIM_VAL, batch(), M(), K())))
+        return status::unimplemented;
+
     // set states
 
     // copy attributes and drop src and weights zero points
@@ -106,6 +113,13 @@ status_t gemm_x8s8s32x_matmul_t<src_type, weights_type, dst_type>::pd_t::init(
     if (!set_default_formats()) return status::unimplemented;
 
     gemm_based::book_acc_scratchpad(*this, params_, sizeof(acc_data_t));
+    if (is_dynamic_quantization) {
+        using namespace memory_tracking::names;
+        auto scratchpad = scratchpad_registry().registrar();
+        scratchpad.template book<int8_t>(
+                key_matmul_src_quantized, batch() * M() * K());
+        scratchpad.template book<float>(key_matmul_src_scales, batch() * M());
+    }
 
     return status::success;
 }
@@ -115,7 +129,7 @@ void gemm_x8s8s32x_matmul_t<src_type, weights_type, dst_type>::
         post_process_src_and_weights_zero_points(
                 std::vector<acc_data_t> &src_comp,
                 std::vector<acc_data_t> &wei_comp, dim_t M, dim_t N, dim_t K,
-                const src_data_t *src, dim_t src_s0, dim_t src_s1,
+                const gemm_src_data_t *src, dim_t src_s0, dim_t src_s1,
                 const weights_data_t *wei, dim_t wei_s0, dim_t wei_s1,
                 acc_data_t *acc, int ldc, acc_data_t src_zero_point,
                 acc_data_t wei_zero_point) const {
@@ -168,7 +182,7 @@ status_t gemm_x8s8s32x_matmul_t<src_type, weights_type, dst_type>::execute_ref(
     if (bias) bias += bias_d.offset0() * bias_d.data_type_size();
     dst += dst_d.offset0();
 
-    src_data_t gemm_off_a = (src_data_t)src_zero_point;
+    gemm_src_data_t gemm_off_a = (gemm_src_data_t)src_zero_point;
     weights_data_t gemm_off_b = (weights_data_t)weights_zero_point;
     bool post_process_src_and_weights_zero_points_outside_of_gemm = false;
     if (gemm_off_a != src_zero_point || gemm_off_b != weights_zero_point) {
@@ -205,11 +219,34 @@ status_t gemm_x8s8s32x_matmul_t<src_type, weights_type, dst_type>::execute_ref(
         need_free_acc = true;
     }
 
-    const auto &src_strides = &src_d.blocking_desc().strides[batched];
+    const gemm_src_data_t *gemm_src = (const gemm_src_data_t *)src;
+    const auto &src_bd = src_d.blocking_desc();
+    dim_t src_strides[2]
+            = {src_bd.strides[batched], src_bd.strides[batched + 1]};
+    dim_t src_batch_stride = src_bd.strides[0];
     const auto &weights_strides = &weights_d.blocking_desc().strides[batched];
 
-    const char *transA
-            = src_strides[1] == 1 && src_d.dims()[batched + 0] > 1 ? "N" : "T";
+    float *src_scales = nullptr;
+    if (is_dynamic_quantization) {
+        const auto scratchpad = ctx.get_scratchpad_grantor();
+        auto src_q = scratchpad.template get<int8_t>(
+                memory_tracking::names::key_matmul_src_quantized);
+        src_scales = scratchpad.template get<float>(
+                memory_tracking::names::key_matmul_src_scales);
+        parallel_nd(batch, M, [&](dim_t b, dim_t m) {
+            src_scales[b * M + m] = inner_product_utils::quantize_src_row(
+                    (const float *)src + b * src_batch_stride
+                            + m * src_strides[0],
+                    K, src_strides[1], src_q + (b * M + m) * K);
+        });
+        // the quantized source is dense
+        gemm_src = (const gemm_src_data_t *)src_q;
+        src_strides[0] = K;
+        src_strides[1] = 1;
+        src_batch_stride = M * K;
+    }
+
+    const char *transA = src_strides[1] == 1 && M > 1 ? "N" : "T";
     const char *transB
             = weights_strides[1] == 1 && weights_d.dims()[batched + 0] > 1
             ? "N"
@@ -222,11 +259,25 @@ status_t gemm_x8s8s32x_matmul_t<src_type, weights_type, dst_type>::execute_ref(
     const float alpha = params.get_gemm_alpha(scales);
     const float beta = params.gemm_beta_;
 
-    const auto src_batch_stride = src_d.blocking_desc().strides[0];
     const auto weights_batch_stride = weights_d.blocking_desc().strides[0];
     const auto dst_batch_stride = dst_d.blocking_desc().strides[0];
     const auto acc_batch_stride = M * N;
 
+    // converts the accumulators of the rows [m_start, m_end) to f32 in
+    // place, right before the post-processing of every row
+    auto dequantize_and_post_process = [=](dst_data_t *d, acc_data_t *a,
+                                               const float *row_scales,
+                                               dim_t m_start, dim_t m_end) {
+        float *a_f32 = (float *)a;
+        for (dim_t m = m_start; m < m_end; ++m) {
+            PRAGMA_OMP_SIMD()
+            for (dim_t n = 0; n < N; ++n)
+                a_f32[m * N + n] = row_scales[m] * a[m * N + n];
+            (*pp_kernel_)(d, (const pp_acc_data_t *)a, bias, scales, m * N,
+                    (m + 1) * N, (size_t)N, &dst_zero_point_f32);
+        }
+    };
+
     status_t st = status::success;
     const bool parallel_over_batch = batch > 1;
     if (parallel_over_batch) {
@@ -249,7 +300,8 @@ status_t gemm_x8s8s32x_matmul_t<src_type, weights_type, dst_type>::execute_ref(
             const int32_t gemm_off_c = 0;
 
             for (size_t b = batch_start; b < batch_end; ++b) {
-                const src_data_t *curr_src = src + b * src_batch_stride;
+                const gemm_src_data_t *curr_src
+                        = gemm_src + b * src_batch_stride;
                 const weights_data_t *curr_weights
                         = weights + b * weights_batch_stride;
                 dst_data_t *curr_dst = dst + b * dst_batch_stride;
@@ -276,9 +328,13 @@ status_t gemm_x8s8s32x_matmul_t<src_type, weights_type, dst_type>::execute_ref(
                         = need_post_processing(pd(), dst_zero_point_f32);
                 assert(IMPLICATION(postops_in_matmul, params.has_pp_kernel_));
 
-                if (postops_in_matmul) {
-                    (*pp_kernel_)(curr_dst, curr_acc, bias, scales, 0, M * N,
-                            (size_t)N, &dst_zero_point_f32);
+                if (is_dynamic_quantization) {
+                    dequantize_and_post_process(
+                            curr_dst, curr_acc, src_scales + b * M, 0, M);
+                } else if (postops_in_matmul) {
+                    (*pp_kernel_)(curr_dst, (const pp_acc_data_t *)curr_acc,
+                            bias, scales, 0, M * N, (size_t)N,
+                            &dst_zero_point_f32);
                 }
             }
         });
@@ -288,8 +344,8 @@ status_t gemm_x8s8s32x_matmul_t<src_type, weights_type, dst_type>::execute_ref(
         const int32_t gemm_off_c = 0;
 
         status_t st = gemm_s8x8s32(transB, transA, "F", &N, &M, &K, &alpha,
-                weights, &ldb, &gemm_off_b, src, &lda, &gemm_off_a, &beta, acc,
-                &ldc, &gemm_off_c);
+                weights, &ldb, &gemm_off_b, gemm_src, &lda, &gemm_off_a, &beta,
+                acc, &ldc, &gemm_off_c);
         if (st != status::success) return st;
 
         std::vector<acc_data_t> src_compensation(M, 0);
@@ -298,7 +354,7 @@ status_t gemm_x8s8s32x_matmul_t<src_type, weights_type, dst_type>::execute_ref(
         // if igemm cannot handle src and weights zero points
         if (post_process_src_and_weights_zero_points_outside_of_gemm) {
             post_process_src_and_weights_zero_points(src_compensation,
-                    weights_compensation, M, N, K, src, src_strides[0],
+                    weights_compensation, M, N, K, gemm_src, src_strides[0],
                     src_strides[1], weights, weights_strides[0],
                     weights_strides[1], acc, ldc, src_zero_point,
                     weights_zero_point);
@@ -307,14 +363,21 @@ status_t gemm_x8s8s32x_matmul_t<src_type, weights_type, dst_type>::execute_ref(
         bool postops_in_matmul = need_post_processing(pd(), dst_zero_point_f32);
         assert(IMPLICATION(postops_in_matmul, params.has_pp_kernel_));
 
-        if (postops_in_matmul) {
+        if (is_dynamic_quantization) {
+            parallel(0, [&](int ithr, int nthr) {
+                dim_t m_start {0}, m_end {0};
+                balance211(M, nthr, ithr, m_start, m_end);
+                dequantize_and_post_process(
+                        dst, acc, src_scales, m_start, m_end);
+            });
+        } else if (postops_in_matmul) {
             const bool force_sequential = pp_kernel_->sequential_kernel();
 
             parallel(force_sequential ? 1 : 0, [&](int ithr, int nthr) {
                 size_t start {}, end {};
                 balance211((size_t)(M * N), nthr, ithr, start, end);
-                (*pp_kernel_)(dst, acc, bias, scales, start, end, (size_t)N,
-                        &dst_zero_point_f32);
+                (*pp_kernel_)(dst, (const pp_acc_data_t *)acc, bias, scales,
+                        start, end, (size_t)N, &dst_zero_point_f32);
             });
         }
     }
@@ -331,6 +394,7 @@ template struct gemm_x8s8s32x_matmul_t<u8, s8, f32>;
 template struct gemm_x8s8s32x_matmul_t<u8, s8, s32>;
 template struct gemm_x8s8s32x_matmul_t<u8, s8, s8>;
 template struct gemm_x8s8s32x_matmul_t<u8, s8, u8>;
+template struct gemm_x8s8s32x_matmul_t<f32, s8, f32>;
 
 } // namespace matmul
 } // namespace cpu
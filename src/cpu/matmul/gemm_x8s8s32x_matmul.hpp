@@ -63,6 +63,14 @@ struct gemm_x8s8s32x_matmul_t : public primitive_t {
     typedef typename prec_traits<dst_type>::type dst_data_t;
     typedef typename prec_traits<acc_type>::type acc_data_t;
 
+    // The f32 source is quantized to s8 on the fly with a scale per row and
+    // the accumulators are dequantized back to f32 before the
+    // post-processing kernel.
+    static constexpr bool is_dynamic_quantization = src_type == data_type::f32;
+    typedef typename prec_traits<is_dynamic_quantization
+                    ? data_type::s8
+                    : src_type>::type gemm_src_data_t;
+
     status_t execute(const exec_ctx_t &ctx) const override {
         return execute_ref(ctx);
     }
@@ -73,12 +81,14 @@ private:
     void post_process_src_and_weights_zero_points(
             std::vector<acc_data_t> &src_comp,
             std::vector<acc_data_t> &wei_comp, dim_t M, dim_t N, dim_t K,
-            const src_data_t *src, dim_t src_s0, dim_t src_s1,
+            const gemm_src_data_t *src, dim_t src_s0, dim_t src_s1,
             const weights_data_t *wei, dim_t wei_s0, dim_t wei_s1,
             acc_data_t *acc, int ldc, acc_data_t src_zero_point,
             acc_data_t wei_zero_point) const;
 
-    using pp_kernel_t = inner_product_utils::pp_kernel_t<acc_type, dst_type>;
+    using pp_kernel_t = inner_product_utils::pp_kernel_t<
+            is_dynamic_quantization ? data_type::f32 : acc_type, dst_type>;
+    typedef typename pp_kernel_t::acc_data_t pp_acc_data_t;
     std::unique_ptr<pp_kernel_t> pp_kernel_;
 };
 
@@ -50,7 +50,7 @@ struct ncsp_batch_normalization_fwd_t : public primitive_t {
             bool ok = is_fwd() && !has_zero_dim_memory()
                     && src_md()->data_type == d_type
                     && platform::has_data_type_support(d_type)
-                    && check_scale_shift_data_type()
+                    && check_scale_shift_data_type() && !fuse_norm_add_relu()
                     && memory_desc_matches_one_of_tag(
                             *src_md(), ncdhw, nchw, nc)
                     && (attr()->has_default_values()
@@ -126,7 +126,7 @@ struct ncsp_batch_normalization_bwd_t : public primitive_t {
                     && utils::everyone_is(d_type, src_md()->data_type,
                             diff_src_md()->data_type)
                     && platform::has_data_type_support(d_type)
-                    && check_scale_shift_data_type()
+                    && check_scale_shift_data_type() && !fuse_norm_add_relu()
                     && memory_desc_matches_one_of_tag(
                             *src_md(), ncdhw, nchw, nc)
                     && memory_desc_matches_one_of_tag(
@@ -62,6 +62,7 @@ void ref_batch_normalization_fwd_t<d_type>::execute_forward(
     if (this->pd()->has_zero_dim_memory()) return;
 
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto src_add = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
     auto scaleshift = CTX_IN_MEM(const acc_data_t *, DNNL_ARG_SCALE_SHIFT);
 
     auto mean = pd()->stats_is_src()
@@ -89,6 +90,7 @@ void ref_batch_normalization_fwd_t<d_type>::execute_forward(
     const auto use_scaleshift = pd()->use_scaleshift();
     const auto calculate_stats = !pd()->stats_is_src();
     const auto fuse_norm_relu = pd()->fuse_norm_relu();
+    const auto fuse_norm_add_relu = pd()->fuse_norm_add_relu();
     const auto save_stats = pd()->is_training();
     const auto is_training = pd()->is_training();
 
@@ -144,7 +146,9 @@ void ref_batch_normalization_fwd_t<d_type>::execute_forward(
             auto d_off = DATA_OFF(data_d, n, c, d, h, w);
             acc_data_t bn_res
                     = sm * (maybe_up_convert(src[d_off]) - v_mean) + sv;
-            if (fuse_norm_relu) {
+            // the second source shares the memory descriptor with the source
+            if (fuse_norm_add_relu) bn_res += maybe_up_convert(src_add[d_off]);
+            if (fuse_norm_relu || fuse_norm_add_relu) {
                 if (bn_res <= 0) {
                     bn_res = 0;
                     if (is_training) ws[d_off] = 0;
@@ -182,6 +186,7 @@ void ref_batch_normalization_bwd_t<d_type>::execute_backward(
     auto ws = CTX_IN_MEM(const uint8_t *, DNNL_ARG_WORKSPACE);
 
     auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
+    auto diff_src_add = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC_1);
     auto diff_scaleshift = CTX_OUT_MEM(acc_data_t *, DNNL_ARG_DIFF_SCALE_SHIFT);
 
     const memory_desc_wrapper data_d(pd()->src_md());
@@ -199,7 +204,8 @@ void ref_batch_normalization_bwd_t<d_type>::execute_backward(
     const auto eps = pd()->desc()->batch_norm_epsilon;
     const auto use_scaleshift = pd()->use_scaleshift();
     const auto calculate_diff_stats = !pd()->use_global_stats();
-    const auto fuse_norm_relu = pd()->fuse_norm_relu();
+    const auto fuse_norm_add_relu = pd()->fuse_norm_add_relu();
+    const auto fuse_norm_relu = pd()->fuse_norm_relu() || fuse_norm_add_relu;
 
     /* fast return */
     if (this->pd()->has_zero_dim_memory()) {
@@ -254,6 +260,9 @@ void ref_batch_normalization_bwd_t<d_type>::execute_backward(
                 dd = 0;
             else
                 dd = maybe_up_convert(diff_dst[dd_off]);
+            // the diff of the second source shares the memory descriptor
+            // with the diff of the source
+            if (fuse_norm_add_relu) diff_src_add[dd_off] = dd;
             acc_data_t v_diff_src = dd;
             if (calculate_diff_stats) {
                 v_diff_src -= diff_beta / (D * W * H * N)
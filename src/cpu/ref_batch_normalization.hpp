@@ -53,7 +53,8 @@ struct ref_batch_normalization_fwd_t : public primitive_t {
             if (src_md()->data_type == s8 && !stats_is_src())
                 return status::unimplemented;
 
-            if (is_training() && fuse_norm_relu()) init_default_ws(8);
+            if (is_training() && (fuse_norm_relu() || fuse_norm_add_relu()))
+                init_default_ws(8);
 
             return status::success;
         }
@@ -93,7 +94,7 @@ struct ref_batch_normalization_bwd_t : public primitive_t {
                     && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
-            if (fuse_norm_relu()) {
+            if (fuse_norm_relu() || fuse_norm_add_relu()) {
                 init_default_ws(8);
                 if (!compare_ws(hint_fwd_pd_)) return status::unimplemented;
             }
@@ -20,6 +20,7 @@
 #include "common/math_utils.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/cpu_primitive.hpp"
 #include "cpu/simple_q10n.hpp"
 
 #include "cpu/ref_convolution.hpp"
@@ -32,13 +33,16 @@ using math::get_bias;
 
 template <data_type_t src_type, data_type_t wei_type, data_type_t dst_type,
         data_type_t acc_type>
-void ref_convolution_fwd_t<src_type, wei_type, dst_type,
+status_t ref_convolution_fwd_t<src_type, wei_type, dst_type,
         acc_type>::execute_forward(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
     auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
     auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
 
+    DEFINE_ZERO_POINT_VALUE(src_zero_point, DNNL_ARG_SRC);
+    DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
+
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
@@ -78,11 +82,11 @@ void ref_convolution_fwd_t<src_type, wei_type, dst_type,
     using namespace data_type;
     bool is_int_conv = utils::one_of(src_type, s32, s8, u8);
 
+    DEFINE_SCALES_BUFFER(scales);
+    // scale_idx_mult = 1 for per_oc scales and 0, otherwise
+    const int scale_idx_mult = pd()->attr()->output_scales_.mask_ == (1 << 1);
+
     auto maybe_oscale = [=](float &d, int g, int oc) {
-        // scale_idx_mult = 1 for per_oc scales and 0, otherwise
-        const int scale_idx_mult
-                = pd()->attr()->output_scales_.mask_ == (1 << 1);
-        const float *scales = pd()->attr()->output_scales_.scales_;
         d *= scales[(g * OC + oc) * scale_idx_mult];
     };
 
@@ -112,20 +116,25 @@ void ref_convolution_fwd_t<src_type, wei_type, dst_type,
             if (ih < 0 || ih >= IH) continue;
             if (iw < 0 || iw >= IW) continue;
 
+            // the padded area is zero in the shifted domain, hence the zero
+            // point is subtracted from the actual source values only
             if (ndims == 5)
-                d += (acc_data_t)src[src_d.off(mb, g * IC + ic, id, ih, iw)]
+                d += ((acc_data_t)src[src_d.off(mb, g * IC + ic, id, ih, iw)]
+                             - src_zero_point)
                         * (with_groups ? weights[weights_d.off(
                                    g, oc, ic, kd, kh, kw)]
                                        : weights[weights_d.off(
                                                oc, ic, kd, kh, kw)]);
             else if (ndims == 4)
-                d += (acc_data_t)src[src_d.off(mb, g * IC + ic, ih, iw)]
+                d += ((acc_data_t)src[src_d.off(mb, g * IC + ic, ih, iw)]
+                             - src_zero_point)
                         * (with_groups ? weights[weights_d.off(
                                    g, oc, ic, kh, kw)]
                                        : weights[weights_d.off(
                                                oc, ic, kh, kw)]);
             else if (ndims == 3)
-                d += (acc_data_t)src[src_d.off(mb, g * IC + ic, iw)]
+                d += ((acc_data_t)src[src_d.off(mb, g * IC + ic, iw)]
+                             - src_zero_point)
                         * (with_groups ? weights[weights_d.off(g, oc, ic, kw)]
                                        : weights[weights_d.off(oc, ic, kw)]);
             else
@@ -188,7 +197,7 @@ void ref_convolution_fwd_t<src_type, wei_type, dst_type,
                     const dim_t weights_off = ic * weights_ic_stride
                             + kd * weights_kd_stride + kh * weights_kh_stride
                             + kw;
-                    d += (acc_data_t)src_loc[src_off]
+                    d += ((acc_data_t)src_loc[src_off] - src_zero_point)
                             * weights_loc[weights_off];
                 }
             }
@@ -207,7 +216,8 @@ void ref_convolution_fwd_t<src_type, wei_type, dst_type,
                         + ih * src_ih_stride + iw * src_iw_stride;
                 const dim_t weights_off = ic * weights_ic_stride
                         + kd * weights_kd_stride + kh * weights_kh_stride + kw;
-                d += (acc_data_t)src_loc[src_off] * weights_loc[weights_off];
+                d += ((acc_data_t)src_loc[src_off] - src_zero_point)
+                        * weights_loc[weights_off];
             }
         }
         return d;
@@ -237,12 +247,15 @@ void ref_convolution_fwd_t<src_type, wei_type, dst_type,
 
                 maybe_oscale(a, g, oc);
                 maybe_postops(a, dst[dst_off]);
+                a += (float)dst_zero_point;
 
                 if (is_int_conv)
                     dst[dst_off] = qz_a1b0<float, dst_data_t>()(a);
                 else
                     dst[dst_off] = saturate<dst_data_t>(a);
             });
+
+    return status::success;
 }
 
 template <data_type_t diff_src_type, data_type_t wei_type,
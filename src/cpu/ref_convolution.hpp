@@ -59,9 +59,11 @@ struct ref_convolution_fwd_t : public primitive_t {
                                             bias_md_.data_type == f32))
                     && set_default_formats()
                     && attr()->has_default_values(
-                            primitive_attr_t::skip_mask_t::oscale
+                            primitive_attr_t::skip_mask_t::oscale_runtime
+                            | primitive_attr_t::skip_mask_t::zero_points_runtime
                             | primitive_attr_t::skip_mask_t::post_ops)
-                    && output_scales_mask_ok() && post_ops_ok();
+                    && output_scales_mask_ok() && zero_points_ok()
+                    && post_ops_ok();
             return ok ? status::success : status::unimplemented;
         }
 
@@ -75,6 +77,15 @@ struct ref_convolution_fwd_t : public primitive_t {
             return set_default_formats_common(dat_tag, wei_tag, dat_tag);
         }
 
+        bool zero_points_ok() const {
+            using namespace data_type;
+            const auto &zp = attr()->zero_points_;
+            return IMPLICATION(!utils::one_of(src_type, s8, u8),
+                           zp.has_default_values())
+                    && zp.has_default_values(DNNL_ARG_WEIGHTS)
+                    && zp.common();
+        }
+
         bool output_scales_mask_ok() const {
             using namespace data_type;
             const auto &mask = attr()->output_scales_.mask_;
@@ -125,12 +136,11 @@ struct ref_convolution_fwd_t : public primitive_t {
     typedef typename prec_traits<acc_type>::type acc_data_t;
 
     status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
-        return status::success;
+        return execute_forward(ctx);
     }
 
 private:
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     ref_eltwise_scalar_fwd_t *eltwises_[dnnl_post_ops::capacity];
 };
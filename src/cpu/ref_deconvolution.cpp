@@ -55,35 +55,55 @@ void ref_deconvolution_fwd_t::compute_fwd_bias(
 template <data_type_t dst_type, data_type_t bia_type>
 void ref_deconvolution_fwd_t::compute_fwd_bias_ncdhw(
         typename prec_traits<dst_type>::type *dst,
+        const typename prec_traits<dst_type>::type *conv_dst,
         const typename prec_traits<bia_type>::type *bias) const {
     const memory_desc_wrapper dst_d(pd()->dst_md());
 
     const int MB = pd()->MB();
     const int OC = pd()->OC();
     const int SP = pd()->OW() * pd()->OH() * pd()->OD();
+    const bool with_post_ops = pd()->with_post_ops();
 
     parallel_nd(MB, OC, [&](int mb, int oc) {
-        PRAGMA_OMP_SIMD()
-        for (int sp = 0; sp < SP; ++sp) {
-            auto offset = (size_t)(mb * OC + oc) * SP + sp;
-            dst[offset] += bias[oc];
+        const size_t offset = (size_t)(mb * OC + oc) * SP;
+        if (!with_post_ops) {
+            PRAGMA_OMP_SIMD()
+            for (int sp = 0; sp < SP; ++sp)
+                dst[offset + sp] += bias[oc];
+            return;
         }
+
+        const float b = bias ? (float)bias[oc] : 0.f;
+        for (int sp = 0; sp < SP; ++sp)
+            dst[offset + sp] = apply_post_ops(
+                    (float)conv_dst[offset + sp] + b, dst[offset + sp]);
     });
 }
 
 template <data_type_t dst_type, data_type_t bia_type>
 void ref_deconvolution_fwd_t::compute_fwd_bias_ndhwc(
         typename prec_traits<dst_type>::type *dst,
+        const typename prec_traits<dst_type>::type *conv_dst,
         const typename prec_traits<bia_type>::type *bias) const {
     const dim_t MB = pd()->MB();
     const dim_t SP = pd()->OW() * pd()->OH() * pd()->OD();
     const dim_t OC = pd()->OC();
+    const bool with_post_ops = pd()->with_post_ops();
 
     parallel_nd(MB, SP, [&](dim_t mb, dim_t sp) {
         const dim_t offset = (mb * SP + sp) * OC;
-        PRAGMA_OMP_SIMD()
+        if (!with_post_ops) {
+            PRAGMA_OMP_SIMD()
+            for (dim_t oc = 0; oc < OC; ++oc) {
+                dst[offset + oc] += bias[oc];
+            }
+            return;
+        }
+
         for (dim_t oc = 0; oc < OC; ++oc) {
-            dst[offset + oc] += bias[oc];
+            const float b = bias ? (float)bias[oc] : 0.f;
+            dst[offset + oc] = apply_post_ops(
+                    (float)conv_dst[offset + oc] + b, dst[offset + oc]);
         }
     });
 }
@@ -91,12 +111,14 @@ void ref_deconvolution_fwd_t::compute_fwd_bias_ndhwc(
 template <data_type_t dst_type, data_type_t bia_type, int blksize>
 void ref_deconvolution_fwd_t::compute_fwd_bias_nCdhwXc(
         typename prec_traits<dst_type>::type *dst,
+        const typename prec_traits<dst_type>::type *conv_dst,
         const typename prec_traits<bia_type>::type *bias) const {
     const memory_desc_wrapper dst_d(pd()->dst_md());
 
     const int MB = pd()->MB();
     const int OC = pd()->OC();
     const int SP = pd()->OW() * pd()->OH() * pd()->OD();
+    const bool with_post_ops = pd()->with_post_ops();
 
     const ptrdiff_t stride_mb = dst_d.blocking_desc().strides[0];
 
@@ -106,41 +128,61 @@ void ref_deconvolution_fwd_t::compute_fwd_bias_nCdhwXc(
                 auto offset = mb * stride_mb + oc * SP + sp * blksize;
                 const int blk = nstl::min(blksize, OC - oc);
 
-                PRAGMA_OMP_SIMD()
-                for (int i = 0; i < blk; ++i)
-                    dst[offset + i] += bias[oc + i];
+                if (!with_post_ops) {
+                    PRAGMA_OMP_SIMD()
+                    for (int i = 0; i < blk; ++i)
+                        dst[offset + i] += bias[oc + i];
+                    return;
+                }
+
+                for (int i = 0; i < blk; ++i) {
+                    const float b = bias ? (float)bias[oc + i] : 0.f;
+                    dst[offset + i] = apply_post_ops(
+                            (float)conv_dst[offset + i] + b, dst[offset + i]);
+                }
             });
 }
 
 template <data_type_t dst_type, data_type_t bia_type>
-void ref_deconvolution_fwd_t::compute_bias(const exec_ctx_t &ctx) const {
+void ref_deconvolution_fwd_t::compute_bias(
+        const exec_ctx_t &ctx, const void *conv_dst_ptr) const {
     typedef typename prec_traits<dst_type>::type dst_data_t;
     typedef typename prec_traits<bia_type>::type bia_data_t;
 
     auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
-    auto bias = CTX_IN_MEM(const bia_data_t *, DNNL_ARG_BIAS);
+    auto conv_dst = conv_dst_ptr ? (const dst_data_t *)conv_dst_ptr : dst;
+    auto bias = pd()->with_bias() && !pd()->conv_supports_bias_
+            ? CTX_IN_MEM(const bia_data_t *, DNNL_ARG_BIAS)
+            : nullptr;
 
     using namespace format_tag;
     switch (pd()->dst_tag_) {
         case ncdhw:
         case nchw:
-        case ncw: compute_fwd_bias_ncdhw<dst_type, bia_type>(dst, bias); break;
+        case ncw:
+            compute_fwd_bias_ncdhw<dst_type, bia_type>(dst, conv_dst, bias);
+            break;
         case ndhwc:
         case nhwc:
-        case nwc: compute_fwd_bias_ndhwc<dst_type, bia_type>(dst, bias); break;
+        case nwc:
+            compute_fwd_bias_ndhwc<dst_type, bia_type>(dst, conv_dst, bias);
+            break;
         case nCdhw8c:
         case nChw8c:
         case nCw8c:
             assert(!utils::one_of(data_type::bf16, dst_type, bia_type));
-            compute_fwd_bias_nCdhwXc<dst_type, bia_type, 8>(dst, bias);
+            compute_fwd_bias_nCdhwXc<dst_type, bia_type, 8>(
+                    dst, conv_dst, bias);
             break;
         case nCdhw16c:
         case nChw16c:
         case nCw16c:
-            compute_fwd_bias_nCdhwXc<dst_type, bia_type, 16>(dst, bias);
+            compute_fwd_bias_nCdhwXc<dst_type, bia_type, 16>(
+                    dst, conv_dst, bias);
             break;
         default:
             assert(!utils::one_of(data_type::bf16, dst_type, bia_type));
+            assert(!pd()->with_post_ops());
             compute_fwd_bias((float *)(dst), (const float *)(bias));
             break;
     }
@@ -308,13 +350,13 @@ void ref_deconvolution_bwd_weights_t::compute_bias(
 using namespace data_type;
 
 template void ref_deconvolution_fwd_t::compute_bias<f32, f32>(
-        const exec_ctx_t &ctx) const;
+        const exec_ctx_t &ctx, const void *conv_dst_ptr) const;
 template void ref_deconvolution_fwd_t::compute_bias<f32, bf16>(
-        const exec_ctx_t &ctx) const;
+        const exec_ctx_t &ctx, const void *conv_dst_ptr) const;
 template void ref_deconvolution_fwd_t::compute_bias<bf16, f32>(
-        const exec_ctx_t &ctx) const;
+        const exec_ctx_t &ctx, const void *conv_dst_ptr) const;
 template void ref_deconvolution_fwd_t::compute_bias<bf16, bf16>(
-        const exec_ctx_t &ctx) const;
+        const exec_ctx_t &ctx, const void *conv_dst_ptr) const;
 
 template void ref_deconvolution_bwd_weights_t::compute_bias<f32, f32>(
         const exec_ctx_t &ctx) const;
@@ -29,6 +29,7 @@
 
 #include "cpu/cpu_convolution_pd.hpp"
 #include "cpu/cpu_deconvolution_pd.hpp"
+#include "cpu/ref_eltwise.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -112,6 +113,9 @@ struct ref_deconvolution_fwd_t : public primitive_t {
             convolution_desc_t cd;
             CHECK(conv_descr_create(desc(), &cd));
             primitive_attr_t conv_attr = *attr();
+            // The post-ops are applied by the deconvolution together with
+            // the bias, right after the backward data convolution
+            conv_attr.post_ops_ = post_ops_t();
             conv_attr.set_scratchpad_mode(scratchpad_mode::user);
             dnnl_primitive_desc_iterator it(
                     engine, (op_desc_t *)&cd, &conv_attr, nullptr);
@@ -120,7 +124,8 @@ struct ref_deconvolution_fwd_t : public primitive_t {
                 conv_supports_bias_
                         = utils::downcast<cpu_convolution_bwd_data_pd_t *>(
                                 conv_pd_.get())
-                                  ->support_bias();
+                                  ->support_bias()
+                        && !with_post_ops();
                 bool ref_deconv_supports_bias = true
                         && desc()->accum_data_type == data_type::f32
                         && utils::one_of(desc()->dst_desc.data_type, f32, bf16)
@@ -138,7 +143,9 @@ struct ref_deconvolution_fwd_t : public primitive_t {
                         /* deconv reference code can process only f32 bias */
                         && IMPLICATION(with_bias(),
                                 conv_supports_bias_
-                                        || ref_deconv_supports_bias);
+                                        || ref_deconv_supports_bias)
+                        && IMPLICATION(
+                                with_post_ops(), ref_deconv_supports_bias);
                 if (ok) return status::success;
             }
             return status::unimplemented;
@@ -150,7 +157,9 @@ struct ref_deconvolution_fwd_t : public primitive_t {
                     && utils::one_of(desc()->alg_kind,
                             alg_kind::deconvolution_direct,
                             alg_kind::deconvolution_winograd)
-                    && attr()->has_default_values();
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops)
+                    && post_ops_ok();
 
             if (ok) {
                 CHECK(init_convolution(engine));
@@ -169,6 +178,9 @@ struct ref_deconvolution_fwd_t : public primitive_t {
                         utils::pick(ndims() - 3, nwc, nhwc, ndhwc),
                         utils::pick(ndims() - 3, nCw8c, nChw8c, nCdhw8c),
                         utils::pick(ndims() - 3, nCw16c, nChw16c, nCdhw16c));
+                // The generic bias code path cannot apply the post-ops
+                if (with_post_ops() && dst_tag_ == format_tag::undef)
+                    return status::unimplemented;
 
                 init_scratchpad();
                 return status::success;
@@ -177,19 +189,64 @@ struct ref_deconvolution_fwd_t : public primitive_t {
             return status::unimplemented;
         }
 
+        bool with_post_ops() const {
+            return !attr()->post_ops_.has_default_values();
+        }
+
+        /** returns true if the previous dst values are used by a sum post-op,
+         * in which case the convolution computes its result into a
+         * temporary buffer */
+        bool with_sum() const {
+            return attr()->post_ops_.find(primitive_kind::sum) != -1;
+        }
+
         std::unique_ptr<primitive_desc_t> conv_pd_;
         bool conv_supports_bias_;
         format_tag_t dst_tag_;
 
     private:
+        bool post_ops_ok() const {
+            using namespace data_type;
+            const auto &po = attr()->post_ops_;
+            auto is_eltwise
+                    = [&](int idx) { return po.entry_[idx].is_eltwise(); };
+            auto is_sum = [&](int idx) {
+                return po.contain(primitive_kind::sum, idx);
+            };
+
+            bool ok = true;
+            switch (po.len_) {
+                case 0: break;
+                case 1: ok = is_eltwise(0) || is_sum(0); break;
+                case 2:
+                    ok = (is_sum(0) && is_eltwise(1))
+                            || (is_sum(1) && is_eltwise(0));
+                    break;
+                default: ok = false;
+            }
+            return ok
+                    && IMPLICATION(po.len_ > 0,
+                            utils::one_of(dst_md_.data_type, f32, bf16));
+        }
+
         void init_scratchpad() {
             auto scratchpad = scratchpad_registry().registrar();
             scratchpad.book(memory_tracking::names::key_nested,
                     conv_pd_->scratchpad_registry());
+            if (with_sum())
+                scratchpad.book<char>(memory_tracking::names::key_deconv_sum,
+                        memory_desc_wrapper(dst_md()).size());
         }
     };
 
-    ref_deconvolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+    ref_deconvolution_fwd_t(const pd_t *apd) : primitive_t(apd) {
+        const auto &post_ops = pd()->attr()->post_ops_;
+        for (int idx = 0; idx < post_ops.len_; ++idx) {
+            const auto &e = post_ops.entry_[idx];
+            if (e.is_eltwise())
+                eltwises_[idx].reset(new ref_eltwise_scalar_fwd_t(e.eltwise));
+        }
+    }
 
     status_t init(engine_t *engine) override {
         return pd()->conv_pd_->create_primitive(conv_p_, engine);
@@ -203,49 +260,81 @@ struct ref_deconvolution_fwd_t : public primitive_t {
         conv_args[DNNL_ARG_WEIGHTS] = args.at(DNNL_ARG_WEIGHTS);
         if (pd()->with_bias() && pd()->conv_supports_bias_)
             conv_args[DNNL_ARG_BIAS] = args.at(DNNL_ARG_BIAS);
-        conv_args[DNNL_ARG_DIFF_SRC] = args.at(DNNL_ARG_DST);
+
+        // With a sum post-op the convolution cannot overwrite dst, hence its
+        // result goes to a temporary buffer of the same layout
+        auto dst = args.at(DNNL_ARG_DST);
+        void *conv_dst_ptr = pd()->with_sum()
+                ? ctx.get_scratchpad_grantor().get<void>(key_deconv_sum)
+                : nullptr;
+        memory_t conv_dst(dst.mem->engine(), pd()->dst_md(),
+                memory_flags_t::use_runtime_ptr, conv_dst_ptr);
+        conv_args[DNNL_ARG_DIFF_SRC]
+                = pd()->with_sum() ? memory_arg_t {&conv_dst, false} : dst;
         exec_ctx_t conv_ctx(ctx.stream(), std::move(conv_args));
 
         nested_scratchpad_t ns(ctx, key_nested, conv_p_);
         conv_ctx.set_scratchpad_grantor(ns.grantor());
         conv_p_->execute(conv_ctx);
 
-        if (pd()->with_bias() && !pd()->conv_supports_bias_) {
+        const bool do_bias = pd()->with_bias() && !pd()->conv_supports_bias_;
+        if (do_bias || pd()->with_post_ops()) {
             using namespace data_type;
 
             auto dst_type = pd()->dst_md()->data_type;
-            auto bia_type = pd()->weights_md(1)->data_type;
+            auto bia_type = do_bias ? pd()->weights_md(1)->data_type : f32;
             if (utils::everyone_is(f32, dst_type, bia_type))
-                compute_bias<f32, f32>(ctx);
+                compute_bias<f32, f32>(ctx, conv_dst_ptr);
             else if (utils::everyone_is(bf16, dst_type, bia_type))
-                compute_bias<bf16, bf16>(ctx);
+                compute_bias<bf16, bf16>(ctx, conv_dst_ptr);
             else if (dst_type == f32 && bia_type == bf16)
-                compute_bias<f32, bf16>(ctx);
+                compute_bias<f32, bf16>(ctx, conv_dst_ptr);
             else if (dst_type == bf16 && bia_type == f32)
-                compute_bias<bf16, f32>(ctx);
+                compute_bias<bf16, f32>(ctx, conv_dst_ptr);
         }
         return status::success;
     }
 
 private:
+    /* The bias and the post-ops are applied in a single pass over dst. The
+     * convolution result is read from conv_dst, which is either dst itself or
+     * a temporary buffer if the previous dst values are used by a sum
+     * post-op. The bias may be nullptr if only the post-ops are applied. */
     void compute_fwd_bias(float *dst, const float *bias) const;
     template <data_type_t dst_type, data_type_t bia_type>
     void compute_fwd_bias_ncdhw(typename prec_traits<dst_type>::type *dst,
+            const typename prec_traits<dst_type>::type *conv_dst,
             const typename prec_traits<bia_type>::type *bias) const;
 
     template <data_type_t dst_type, data_type_t bia_type>
     void compute_fwd_bias_ndhwc(typename prec_traits<dst_type>::type *dst,
+            const typename prec_traits<dst_type>::type *conv_dst,
             const typename prec_traits<bia_type>::type *bias) const;
 
     template <data_type_t dst_type, data_type_t bia_type, int blksize>
     void compute_fwd_bias_nCdhwXc(typename prec_traits<dst_type>::type *dst,
+            const typename prec_traits<dst_type>::type *conv_dst,
             const typename prec_traits<bia_type>::type *bias) const;
 
     template <data_type_t dst_type, data_type_t bia_type>
-    void compute_bias(const exec_ctx_t &ctx) const;
+    void compute_bias(const exec_ctx_t &ctx, const void *conv_dst_ptr) const;
+
+    float apply_post_ops(float d, float dst) const {
+        const auto &post_ops = pd()->attr()->post_ops_;
+        for (int idx = 0; idx < post_ops.len_; ++idx) {
+            const auto &e = post_ops.entry_[idx];
+            if (e.kind == primitive_kind::sum)
+                d += e.sum.scale * dst;
+            else
+                d = eltwises_[idx]->compute_scalar(d);
+        }
+        return d;
+    }
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     std::shared_ptr<primitive_t> conv_p_;
+    std::unique_ptr<ref_eltwise_scalar_fwd_t>
+            eltwises_[dnnl_post_ops::capacity];
 };
 
 struct ref_deconvolution_bwd_data_t : public primitive_t {
@@ -46,6 +46,7 @@ template <impl::data_type_t d_type>
 void ref_layer_normalization_fwd_t<d_type>::execute_forward(
         const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto src_add = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
     auto scaleshift = CTX_IN_MEM(const float *, DNNL_ARG_SCALE_SHIFT);
 
     auto mean = pd()->stats_are_src()
@@ -69,6 +70,7 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
     const bool use_scaleshift = pd()->use_scaleshift();
     const bool save_stats = pd()->is_training();
     const bool calculate_stats = !pd()->stats_are_src();
+    const bool fuse_add = pd()->fuse_add_norm();
 
     /* fast return */
     if (this->pd()->has_zero_dim_memory()) {
@@ -81,6 +83,13 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
         return;
     }
 
+    // the second source shares the memory descriptor with the source
+    auto src_value = [&](size_t off) {
+        float v = maybe_up_convert(src[off]);
+        if (fuse_add) v += maybe_up_convert(src_add[off]);
+        return v;
+    };
+
     parallel_nd(N, [&](dim_t n) {
         const size_t s_off = stat_d.off_l(n);
         auto v_mean = calculate_stats ? 0 : mean[s_off];
@@ -88,11 +97,11 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
 
         if (calculate_stats) {
             for (dim_t c = 0; c < C; ++c)
-                v_mean += maybe_up_convert(src[src_d.off_l(n * C + c)]);
+                v_mean += src_value(src_d.off_l(n * C + c));
             v_mean /= C;
 
             for (dim_t c = 0; c < C; ++c) {
-                float m = src[src_d.off_l(n * C + c)] - v_mean;
+                float m = src_value(src_d.off_l(n * C + c)) - v_mean;
                 v_variance += m * m;
             }
             v_variance /= C;
@@ -109,7 +118,7 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
             const size_t dst_off = dst_d.off_l(n * C + c),
                          src_off = src_d.off_l(n * C + c);
 
-            dst[dst_off] = sm * (maybe_up_convert(src[src_off]) - v_mean) + sv;
+            dst[dst_off] = sm * (src_value(src_off) - v_mean) + sv;
         }
 
         if (calculate_stats) {
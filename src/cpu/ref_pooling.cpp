@@ -288,6 +288,8 @@ template struct ref_pooling_fwd_t<data_type::u8, data_type::s32>;
 template struct ref_pooling_bwd_t<data_type::f32>;
 template struct ref_pooling_bwd_t<data_type::s32>;
 template struct ref_pooling_bwd_t<data_type::bf16>;
+template struct ref_pooling_bwd_t<data_type::s8>;
+template struct ref_pooling_bwd_t<data_type::u8>;
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
@@ -83,7 +83,10 @@ struct ref_pooling_bwd_t : public primitive_t {
                     && set_default_params() == status::success && !is_fwd()
                     && utils::everyone_is(data_type, diff_dst_md()->data_type,
                             diff_src_md()->data_type)
-                    && attr()->has_default_values();
+                    && attr()->has_default_values()
+                    && IMPLICATION(utils::one_of(data_type, data_type::s8,
+                                           data_type::u8),
+                            int8_ok());
             if (!ok) return status::unimplemented;
 
             if (desc()->alg_kind == alg_kind::pooling_max) {
@@ -93,6 +96,14 @@ struct ref_pooling_bwd_t : public primitive_t {
 
             return status::success;
         }
+
+    private:
+        // The int8 gradients are exact only when every diff_src point gets
+        // at most one of them, i.e. the max pooling windows do not overlap
+        bool int8_ok() const {
+            return desc()->alg_kind == alg_kind::pooling_max && KD() <= KSD()
+                    && KH() <= KSH() && KW() <= KSW();
+        }
     };
 
     ref_pooling_bwd_t(const pd_t *apd) : primitive_t(apd) {}
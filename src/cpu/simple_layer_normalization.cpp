@@ -23,6 +23,7 @@
 
 #include "cpu/cpu_batch_normalization_utils.hpp"
 #include "cpu/cpu_engine.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/simple_layer_normalization.hpp"
 
@@ -40,6 +41,8 @@ status_t fill_compatible_stats_md(
         const memory_desc_t &src_md, memory_desc_t &stat_md) {
     stat_md = src_md;
     stat_md.ndims -= 1;
+    // the statistics are f32 regardless of the data type
+    stat_md.data_type = data_type::f32;
     return memory_desc_init_by_blocking_desc(
             stat_md, src_md.format_desc.blocking);
 }
@@ -64,16 +67,23 @@ status_t create_reorder_pd(engine_t *engine, const memory_desc_t *from_md,
 
 status_t simple_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
     using namespace data_type;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
     const memory_desc_wrapper src_d(src_md());
     const memory_desc_wrapper stat_d(stat_md());
 
+    // src and dst share the memory descriptor, hence the data type
+    const data_type_t data_type = src_md()->data_type;
     bool ok = is_fwd() && !has_zero_dim_memory()
-            && utils::everyone_is(f32, src_md()->data_type,
-                    stat_md()->data_type, dst_md()->data_type)
-            && check_scale_shift_data_type() && src_d.is_blocking_desc()
+            && utils::one_of(data_type, f32, bf16, s8, u8)
+            && platform::has_data_type_support(data_type)
+            && stat_md()->data_type == f32 && check_scale_shift_data_type()
+            && src_d.is_blocking_desc()
             && src_d.blocking_desc().strides[ndims() - 1]
                     == 1 // plain format, last logical dim is last physical
-            && attr()->has_default_values() && set_default_formats_common();
+            && attr()->has_default_values(skip_mask_t::oscale)
+            && attr()->output_scales_.mask_ == 0
+            && attr()->output_scales_.defined()
+            && set_default_formats_common();
     if (!ok) return status::unimplemented;
 
     CHECK(fill_compatible_stats_md(*src_md(), reordered_stat_md_));
@@ -85,14 +95,16 @@ status_t simple_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
                 reorder_pd_));
     }
 
+    init_C_split();
     init_scratchpad();
     return status::success;
 }
 
 void simple_layer_normalization_fwd_t::execute_forward(
         const exec_ctx_t &ctx) const {
-    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
-    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto src_add = CTX_IN_MEM(const char *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
     auto scaleshift = CTX_IN_MEM(const float *, DNNL_ARG_SCALE_SHIFT);
 
     float *mean, *variance;
@@ -114,19 +126,30 @@ void simple_layer_normalization_fwd_t::execute_forward(
 
     const dim_t N = pd()->across_axis();
     const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
+    const size_t data_size = src_d.data_type_size();
 
     const bool save_stats = pd()->is_training();
     const bool calculate_stats = !pd()->stats_are_src();
+    const bool fuse_add = pd()->fuse_add_norm();
+
+    if (pd()->split_C()) {
+        execute_forward_split_C(ctx, mean, variance);
+        return;
+    }
 
     parallel_nd(N, [&](dim_t n) {
         auto v_mean = calculate_stats ? 0 : mean[n];
         auto v_variance = calculate_stats ? 0 : variance[n];
 
+        // the second source shares the memory descriptor with the source
+        const size_t off = n * C_padded * data_size;
+        const char *row_add = fuse_add ? &src_add[off] : nullptr;
+
         if (calculate_stats)
-            (*stat_kernel_)(&src[n * C_padded], &v_mean, &v_variance);
+            (*stat_kernel_)(&src[off], row_add, &v_mean, &v_variance);
 
-        (*data_kernel_)(&src[n * C_padded], &dst[n * C_padded], scaleshift,
-                &v_mean, &v_variance);
+        (*data_kernel_)(&src[off], row_add, &dst[off], scaleshift, &v_mean,
+                &v_variance);
 
         if (calculate_stats) {
             if (save_stats) {
@@ -137,6 +160,91 @@ void simple_layer_normalization_fwd_t::execute_forward(
     });
 }
 
+/* The rows are split in chunks processed by different threads. Each chunk
+ * reports the sum of its elements S_i and the sum of the squared deviations
+ * from its own mean Q_i. The statistics of the row are then combined as
+ *   mean = sum(S_i) / C,
+ *   var = (sum(Q_i) + sum(L_i * (S_i / L_i - mean)^2)) / C,
+ * where L_i is the length of the chunk. This keeps the precision of the
+ * two-pass algorithm used for the whole rows. */
+void simple_layer_normalization_fwd_t::execute_forward_split_C(
+        const exec_ctx_t &ctx, float *mean, float *variance) const {
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto src_add = CTX_IN_MEM(const char *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    auto scaleshift = CTX_IN_MEM(const float *, DNNL_ARG_SCALE_SHIFT);
+    auto scratchpad = ctx.get_scratchpad_grantor();
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+
+    const dim_t N = pd()->across_axis();
+    const dim_t C = pd()->norm_axis();
+    const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
+    const size_t data_size = src_d.data_type_size();
+
+    const int nthr_c = pd()->nthr_c();
+    const dim_t C_chunk = pd()->C_chunk();
+    const dim_t C_tail = pd()->C_tail();
+
+    const bool calculate_stats = !pd()->stats_are_src();
+    const bool fuse_add = pd()->fuse_add_norm();
+
+    auto chunk_len = [&](int ic) { return ic < nthr_c - 1 ? C_chunk : C_tail; };
+    auto is_tail = [&](int ic) {
+        return ic == nthr_c - 1 && stat_tail_kernel_ != nullptr;
+    };
+
+    float *partial = calculate_stats
+            ? scratchpad.template get<float>(key_lnorm_reduction)
+            : nullptr;
+
+    if (calculate_stats) {
+        parallel_nd(N, nthr_c, [&](dim_t n, int ic) {
+            const size_t off = (n * C_padded + ic * C_chunk) * data_size;
+            const char *chunk_add = fuse_add ? &src_add[off] : nullptr;
+            float *p = &partial[2 * (n * nthr_c + ic)];
+            const auto &ker = is_tail(ic) ? stat_tail_kernel_ : stat_kernel_;
+            (*ker)(&src[off], chunk_add, &p[0], &p[1]);
+        });
+    }
+
+    parallel_nd(N, nthr_c, [&](dim_t n, int ic) {
+        float v_mean, v_variance;
+        if (calculate_stats) {
+            // every chunk combines the statistics of the row by itself to
+            // avoid an extra synchronization
+            const float *p = &partial[2 * n * nthr_c];
+            float sum = 0;
+            for (int i = 0; i < nthr_c; ++i)
+                sum += p[2 * i];
+            v_mean = sum / C;
+
+            float m2 = 0;
+            for (int i = 0; i < nthr_c; ++i) {
+                const float len = (float)chunk_len(i);
+                const float d = p[2 * i] / len - v_mean;
+                m2 += p[2 * i + 1] + len * d * d;
+            }
+            v_variance = m2 / C;
+
+            if (ic == 0) {
+                mean[n] = v_mean;
+                variance[n] = v_variance;
+            }
+        } else {
+            v_mean = mean[n];
+            v_variance = variance[n];
+        }
+
+        const size_t off = (n * C_padded + ic * C_chunk) * data_size;
+        const char *chunk_add = fuse_add ? &src_add[off] : nullptr;
+        const float *chunk_ss
+                = scaleshift ? &scaleshift[ic * C_chunk] : nullptr;
+        const auto &ker = is_tail(ic) ? data_tail_kernel_ : data_kernel_;
+        (*ker)(&src[off], chunk_add, &dst[off], chunk_ss, &v_mean, &v_variance);
+    });
+}
+
 status_t simple_layer_normalization_bwd_t::pd_t::init(engine_t *engine) {
     using namespace data_type;
     const memory_desc_wrapper src_d(src_md());
@@ -62,10 +62,37 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
 
         bool use_tmp_stats() const { return reorder_pd_ || stats_are_tmp(); }
 
+        /* The normalized axis is split in nthr_c() chunks of C_chunk()
+         * elements (the last one may be shorter) when there are not enough
+         * rows to keep all the threads busy */
+        bool split_C() const { return nthr_c_ > 1; }
+        int nthr_c() const { return nthr_c_; }
+        dim_t C_chunk() const { return C_chunk_; }
+        dim_t C_tail() const { return norm_axis() - (nthr_c_ - 1) * C_chunk_; }
+
         std::unique_ptr<primitive_desc_t> reorder_pd_;
         memory_desc_t reordered_stat_md_;
 
     private:
+        void init_C_split() {
+            const dim_t N = across_axis();
+            const dim_t C = norm_axis();
+            const int nthr = dnnl_get_max_threads();
+            // a chunk should be long enough to amortize the reduction of
+            // the partial statistics
+            const dim_t min_C_chunk = 1024;
+
+            nthr_c_ = 1;
+            C_chunk_ = C;
+            if (N >= nthr) return;
+
+            const dim_t nthr_c = nstl::min<dim_t>(nthr / N, C / min_C_chunk);
+            if (nthr_c < 2) return;
+
+            C_chunk_ = utils::rnd_up(utils::div_up(C, nthr_c), 16);
+            nthr_c_ = (int)utils::div_up(C, C_chunk_);
+        }
+
         void init_scratchpad() {
             using namespace memory_tracking::names;
             auto scratchpad = scratchpad_registry().registrar();
@@ -73,6 +100,11 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
                 scratchpad.book<float>(key_lnorm_tmp_mean, across_axis());
                 scratchpad.book<float>(key_lnorm_tmp_var, across_axis());
             }
+            if (split_C() && !stats_are_src()) {
+                // partial sums and sums of squared deviations of the chunks
+                scratchpad.book<float>(
+                        key_lnorm_reduction, 2 * across_axis() * nthr_c_);
+            }
             if (reordered_stat_md_ != *stat_md() && !stats_are_tmp()) {
                 scratchpad.book(key_nested, reorder_pd_->scratchpad_registry());
             }
@@ -82,14 +114,26 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
             reordered_stat_md_ = other.reordered_stat_md_;
             reorder_pd_.reset(
                     other.reorder_pd_ ? other.reorder_pd_->clone() : nullptr);
+            nthr_c_ = other.nthr_c_;
+            C_chunk_ = other.C_chunk_;
         }
+
+        int nthr_c_ = 1;
+        dim_t C_chunk_ = 0;
     };
 
     status_t init(engine_t *engine) override {
+        using namespace lnorm_utils;
         if (pd()->reorder_pd_)
             pd()->reorder_pd_->create_primitive(reorder_, engine);
-        stat_kernel_.reset(lnorm_utils::statistics_kernel_t::create(pd()));
-        data_kernel_.reset(lnorm_utils::data_kernel_t::create(pd()));
+        const int C_chunk = (int)pd()->C_chunk();
+        const int C_tail = (int)pd()->C_tail();
+        stat_kernel_.reset(statistics_kernel_t::create(pd(), C_chunk));
+        data_kernel_.reset(data_kernel_t::create(pd(), C_chunk));
+        if (C_tail != C_chunk) {
+            stat_tail_kernel_.reset(statistics_kernel_t::create(pd(), C_tail));
+            data_tail_kernel_.reset(data_kernel_t::create(pd(), C_tail));
+        }
         return status::success;
     }
 
@@ -144,10 +188,15 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
 
 private:
     void execute_forward(const exec_ctx_t &ctx) const;
+    void execute_forward_split_C(
+            const exec_ctx_t &ctx, float *mean, float *variance) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     std::unique_ptr<lnorm_utils::statistics_kernel_t> stat_kernel_;
     std::unique_ptr<lnorm_utils::data_kernel_t> data_kernel_;
+    // kernels for the last chunk of the row, if it is shorter
+    std::unique_ptr<lnorm_utils::statistics_kernel_t> stat_tail_kernel_;
+    std::unique_ptr<lnorm_utils::data_kernel_t> data_tail_kernel_;
     std::shared_ptr<primitive_t> reorder_;
 };
 
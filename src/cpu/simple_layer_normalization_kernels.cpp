@@ -14,7 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <assert.h>
+#include <math.h>
+
+#include "common/bfloat16.hpp"
+#include "common/type_helpers.hpp"
+
 #include "cpu/platform.hpp"
+#include "cpu/simple_q10n.hpp"
 
 #if DNNL_X64
 #include "cpu/x64/jit_simple_layer_normalization_kernels.hpp"
@@ -27,38 +34,99 @@ namespace impl {
 namespace cpu {
 namespace lnorm_utils {
 
-void statistics_kernel_t::operator()(
-        const float *src, float *mean, float *var) const {
-    float v_mean = 0;
-    PRAGMA_OMP_SIMD(reduction(+ : v_mean))
-    for (dim_t c = 0; c < C_; ++c) {
-        v_mean += src[c];
+namespace {
+
+template <data_type_t d_type>
+void compute_statistics(dim_t C, const void *src_, const void *src_add_,
+        float *mean, float *var, bool return_sums) {
+    using data_t = typename prec_traits<d_type>::type;
+    const data_t *src = static_cast<const data_t *>(src_);
+    const data_t *src_add = static_cast<const data_t *>(src_add_);
+
+    auto src_value = [&](dim_t c) {
+        float v = src[c];
+        if (src_add) v += (float)src_add[c];
+        return v;
+    };
+
+    float v_sum = 0;
+    PRAGMA_OMP_SIMD(reduction(+ : v_sum))
+    for (dim_t c = 0; c < C; ++c) {
+        v_sum += src_value(c);
     }
-    v_mean /= C_;
+    const float v_mean = v_sum / C;
 
     float v_variance = 0;
     PRAGMA_OMP_SIMD(reduction(+ : v_variance))
-    for (dim_t c = 0; c < C_; ++c) {
-        auto m = src[c] - v_mean;
+    for (dim_t c = 0; c < C; ++c) {
+        auto m = src_value(c) - v_mean;
         v_variance += m * m;
     }
-    v_variance /= C_;
 
-    *mean = v_mean;
-    *var = v_variance;
+    *mean = return_sums ? v_sum : v_mean;
+    *var = return_sums ? v_variance : v_variance / C;
 }
 
-void data_kernel_t::operator()(const float *src, float *dst, const float *ss,
-        const float *mean, const float *var) const {
-    float inv_sqrtvar = 1. / sqrtf(*var + eps_);
+template <data_type_t d_type>
+void compute_data(dim_t C, const void *src_, const void *src_add_,
+        void *dst_, const float *ss, dim_t shift_off, bool use_scaleshift,
+        float mean, float inv_sqrtvar, float output_scale) {
+    using data_t = typename prec_traits<d_type>::type;
+    const data_t *src = static_cast<const data_t *>(src_);
+    const data_t *src_add = static_cast<const data_t *>(src_add_);
+    data_t *dst = static_cast<data_t *>(dst_);
+
     PRAGMA_OMP_SIMD()
-    for (dim_t c = 0; c < C_; ++c) {
-        const float sm = (use_scaleshift_ ? ss[c] : 1.0f) * inv_sqrtvar;
-        const float sv = use_scaleshift_ ? ss[C_ + c] : 0;
-        dst[c] = sm * (src[c] - *mean) + sv;
+    for (dim_t c = 0; c < C; ++c) {
+        const float sm = (use_scaleshift ? ss[c] : 1.0f) * inv_sqrtvar;
+        const float sv = use_scaleshift ? ss[shift_off + c] : 0;
+        float v = src[c];
+        if (src_add) v += (float)src_add[c];
+        dst[c] = saturate_and_round<data_t>(
+                output_scale * (sm * (v - mean) + sv));
     }
 }
 
+} // namespace
+
+void statistics_kernel_t::operator()(const void *src, const void *src_add,
+        float *mean, float *var) const {
+    using namespace data_type;
+    const void *add = with_add_ ? src_add : nullptr;
+#define CASE(dt) \
+    case dt: \
+        compute_statistics<dt>(C_, src, add, mean, var, return_sums_); \
+        break
+    switch (data_type_) {
+        CASE(f32);
+        CASE(bf16);
+        CASE(s8);
+        CASE(u8);
+        default: assert(!"unsupported data type");
+    }
+#undef CASE
+}
+
+void data_kernel_t::operator()(const void *src, const void *src_add,
+        void *dst, const float *ss, const float *mean, const float *var) const {
+    using namespace data_type;
+    const void *add = with_add_ ? src_add : nullptr;
+    const float inv_sqrtvar = 1. / sqrtf(*var + eps_);
+#define CASE(dt) \
+    case dt: \
+        compute_data<dt>(C_, src, add, dst, ss, shift_off_, use_scaleshift_, \
+                *mean, inv_sqrtvar, output_scale_); \
+        break
+    switch (data_type_) {
+        CASE(f32);
+        CASE(bf16);
+        CASE(s8);
+        CASE(u8);
+        default: assert(!"unsupported data type");
+    }
+#undef CASE
+}
+
 void diff_ss_kernel_t::operator()(const float *src, const float *diff_dst,
         float *diff_gamma, float *diff_beta, const float *mean,
         const float *var) const {
@@ -100,22 +168,23 @@ void diff_data_kernel_t::operator()(const float *src, const float *diff_dst,
 // Interface section
 
 statistics_kernel_t *statistics_kernel_t::create(
-        const layer_normalization_pd_t *pd) {
+        const layer_normalization_pd_t *pd, int C) {
 #if DNNL_X64
-    auto *res = x64::lnorm_utils::jit_statistics_kernel_create(pd);
+    auto *res = x64::lnorm_utils::jit_statistics_kernel_create(pd, C);
     if (res) return res;
 #endif
 
-    return new statistics_kernel_t(pd);
+    return new statistics_kernel_t(pd, C);
 }
 
-data_kernel_t *data_kernel_t::create(const layer_normalization_pd_t *pd) {
+data_kernel_t *data_kernel_t::create(
+        const layer_normalization_pd_t *pd, int C) {
 #if DNNL_X64
-    auto *res = x64::lnorm_utils::jit_data_kernel_create(pd);
+    auto *res = x64::lnorm_utils::jit_data_kernel_create(pd, C);
     if (res) return res;
 #endif
 
-    return new data_kernel_t(pd);
+    return new data_kernel_t(pd, C);
 }
 
 diff_ss_kernel_t *diff_ss_kernel_t::create(const layer_normalization_pd_t *pd) {
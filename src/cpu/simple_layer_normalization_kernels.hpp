@@ -24,35 +24,61 @@ namespace impl {
 namespace cpu {
 namespace lnorm_utils {
 
+/* The forward kernels process C elements of a row of data of the source data
+ * type (f32, bf16, s8 or u8): either the whole row (C == norm_axis) or its
+ * chunk, when the normalized axis is split across threads. If the second
+ * source is fused (add-norm), it has the same data type and is added to the
+ * source on every read. The statistics are always computed in f32. */
 struct statistics_kernel_t {
-    static statistics_kernel_t *create(const layer_normalization_pd_t *pd);
+    static statistics_kernel_t *create(
+            const layer_normalization_pd_t *pd, int C);
     virtual ~statistics_kernel_t() = default;
 
-    virtual void operator()(const float *src, float *mean, float *var) const;
+    /* Computes the mean and the variance of the row. For a chunk of the row
+     * the kernel returns the sum of the elements and the sum of the squared
+     * deviations from the chunk mean instead, so that the statistics of the
+     * chunks can be combined without loss of precision. */
+    virtual void operator()(const void *src, const void *src_add, float *mean,
+            float *var) const;
 
 protected:
-    statistics_kernel_t(const layer_normalization_pd_t *pd)
-        : C_(pd->norm_axis()) {}
+    statistics_kernel_t(const layer_normalization_pd_t *pd, int C)
+        : C_(C)
+        , data_type_(pd->src_md()->data_type)
+        , with_add_(pd->fuse_add_norm())
+        , return_sums_(C < pd->norm_axis()) {}
 
     int C_;
+    data_type_t data_type_;
+    bool with_add_;
+    bool return_sums_;
 };
 
 struct data_kernel_t {
-    static data_kernel_t *create(const layer_normalization_pd_t *pd);
+    static data_kernel_t *create(const layer_normalization_pd_t *pd, int C);
     virtual ~data_kernel_t() = default;
 
-    virtual void operator()(const float *src, float *dst, const float *ss,
-            const float *mean, const float *var) const;
+    // ss points to the scale of the first element processed
+    virtual void operator()(const void *src, const void *src_add, void *dst,
+            const float *ss, const float *mean, const float *var) const;
 
 protected:
-    data_kernel_t(const layer_normalization_pd_t *pd)
-        : C_(pd->norm_axis())
+    data_kernel_t(const layer_normalization_pd_t *pd, int C)
+        : C_(C)
+        , shift_off_(pd->norm_axis())
+        , data_type_(pd->src_md()->data_type)
+        , with_add_(pd->fuse_add_norm())
         , use_scaleshift_(pd->use_scaleshift())
-        , eps_(pd->desc()->layer_norm_epsilon) {}
+        , eps_(pd->desc()->layer_norm_epsilon)
+        , output_scale_(pd->attr()->output_scales_.scales_[0]) {}
 
     int C_;
+    dim_t shift_off_; // offset of the shift from the scale
+    data_type_t data_type_;
+    bool with_add_;
     bool use_scaleshift_;
     const float eps_;
+    const float output_scale_;
 };
 
 struct diff_ss_kernel_t {
@@ -33,8 +33,9 @@ namespace cpu {
 using namespace format_tag;
 using namespace resampling_utils;
 
-template <impl::data_type_t data_type>
-simple_resampling_fwd_t<data_type>::simple_resampling_fwd_t(const pd_t *apd)
+template <impl::data_type_t src_type, impl::data_type_t dst_type>
+simple_resampling_fwd_t<src_type, dst_type>::simple_resampling_fwd_t(
+        const pd_t *apd)
     : primitive_t(apd) {
     if (pd()->desc()->alg_kind == alg_kind::resampling_nearest)
         interpolate = &simple_resampling_fwd_t::nearest;
@@ -55,13 +56,22 @@ simple_resampling_fwd_t<data_type>::simple_resampling_fwd_t(const pd_t *apd)
     stride_d_ = pd()->IH() * pd()->IW() * inner_stride_;
     stride_h_ = pd()->IW() * inner_stride_;
     stride_w_ = inner_stride_;
+
+    oscale_ = pd()->attr()->output_scales_.scales_[0];
+    with_attr_ = !pd()->attr()->has_default_values();
+    const auto &post_ops = pd()->attr()->post_ops_;
+    for (int idx = 0; idx < post_ops.len_; ++idx) {
+        const auto &e = post_ops.entry_[idx];
+        if (e.is_eltwise())
+            eltwises_[idx].reset(new ref_eltwise_scalar_fwd_t(e.eltwise));
+    }
 }
 
-template <impl::data_type_t data_type>
-simple_resampling_fwd_t<data_type>::~simple_resampling_fwd_t() {}
+template <impl::data_type_t src_type, impl::data_type_t dst_type>
+simple_resampling_fwd_t<src_type, dst_type>::~simple_resampling_fwd_t() {}
 
-template <impl::data_type_t data_type>
-void simple_resampling_fwd_t<data_type>::fill_coeffs() {
+template <impl::data_type_t src_type, impl::data_type_t dst_type>
+void simple_resampling_fwd_t<src_type, dst_type>::fill_coeffs() {
     using namespace resampling_utils;
     linear_coeffs_.reserve(pd()->OD() + pd()->OH() + pd()->OW());
     for (dim_t od = 0; od < pd()->OD(); od++)
@@ -72,21 +82,24 @@ void simple_resampling_fwd_t<data_type>::fill_coeffs() {
         linear_coeffs_.push_back(linear_coeffs_t(ow, pd()->FW(), pd()->IW()));
 }
 
-template <impl::data_type_t data_type>
-void simple_resampling_fwd_t<data_type>::nearest(
-        const data_t *src, data_t *dst, dim_t od, dim_t oh, dim_t ow) const {
+template <impl::data_type_t src_type, impl::data_type_t dst_type>
+void simple_resampling_fwd_t<src_type, dst_type>::nearest(
+        const src_data_t *src, dst_data_t *dst, dim_t od, dim_t oh,
+        dim_t ow) const {
     dim_t id = nearest_idx(od, pd()->FD()), ih = nearest_idx(oh, pd()->FH()),
           iw = nearest_idx(ow, pd()->FW());
 
     PRAGMA_OMP_SIMD()
     for (dim_t innermost_el = 0; innermost_el < inner_stride_; innermost_el++)
-        dst[innermost_el] = src[id * stride_d_ + ih * stride_h_ + iw * stride_w_
-                + innermost_el];
+        dst[innermost_el] = finalize((float)src[id * stride_d_ + ih * stride_h_
+                                             + iw * stride_w_ + innermost_el],
+                dst[innermost_el]);
 }
 
-template <impl::data_type_t data_type>
-void simple_resampling_fwd_t<data_type>::linear(
-        const data_t *src, data_t *dst, dim_t od, dim_t oh, dim_t ow) const {
+template <impl::data_type_t src_type, impl::data_type_t dst_type>
+void simple_resampling_fwd_t<src_type, dst_type>::linear(
+        const src_data_t *src, dst_data_t *dst, dim_t od, dim_t oh,
+        dim_t ow) const {
     linear_coeffs_t iw = linear_coeffs_[pd()->OD() + pd()->OH() + ow];
 
     PRAGMA_OMP_SIMD()
@@ -94,13 +107,14 @@ void simple_resampling_fwd_t<data_type>::linear(
         float d = 0;
         for (int k = 0; k < 2; k++)
             d += (float)src[iw.idx[k] * stride_w_ + innermost_el] * iw.wei[k];
-        dst[innermost_el] = d;
+        dst[innermost_el] = finalize(d, dst[innermost_el]);
     }
 }
 
-template <impl::data_type_t data_type>
-void simple_resampling_fwd_t<data_type>::bilinear(
-        const data_t *src, data_t *dst, dim_t od, dim_t oh, dim_t ow) const {
+template <impl::data_type_t src_type, impl::data_type_t dst_type>
+void simple_resampling_fwd_t<src_type, dst_type>::bilinear(
+        const src_data_t *src, dst_data_t *dst, dim_t od, dim_t oh,
+        dim_t ow) const {
     linear_coeffs_t ih = linear_coeffs_[pd()->OD() + oh],
                     iw = linear_coeffs_[pd()->OD() + pd()->OH() + ow];
 
@@ -112,13 +126,14 @@ void simple_resampling_fwd_t<data_type>::bilinear(
             d += (float)src[ih.idx[j] * stride_h_ + iw.idx[k] * stride_w_
                          + innermost_el]
                     * ih.wei[j] * iw.wei[k];
-        dst[innermost_el] = d;
+        dst[innermost_el] = finalize(d, dst[innermost_el]);
     }
 }
 
-template <impl::data_type_t data_type>
-void simple_resampling_fwd_t<data_type>::trilinear(
-        const data_t *src, data_t *dst, dim_t od, dim_t oh, dim_t ow) const {
+template <impl::data_type_t src_type, impl::data_type_t dst_type>
+void simple_resampling_fwd_t<src_type, dst_type>::trilinear(
+        const src_data_t *src, dst_data_t *dst, dim_t od, dim_t oh,
+        dim_t ow) const {
     linear_coeffs_t id = linear_coeffs_[od],
                     ih = linear_coeffs_[pd()->OD() + oh],
                     iw = linear_coeffs_[pd()->OD() + pd()->OH() + ow];
@@ -132,15 +147,15 @@ void simple_resampling_fwd_t<data_type>::trilinear(
             d += (float)src[id.idx[i] * stride_d_ + ih.idx[j] * stride_h_
                          + iw.idx[k] * stride_w_ + innermost_el]
                     * id.wei[i] * ih.wei[j] * iw.wei[k];
-        dst[innermost_el] = d;
+        dst[innermost_el] = finalize(d, dst[innermost_el]);
     }
 }
 
-template <impl::data_type_t data_type>
-void simple_resampling_fwd_t<data_type>::execute_forward(
+template <impl::data_type_t src_type, impl::data_type_t dst_type>
+void simple_resampling_fwd_t<src_type, dst_type>::execute_forward(
         const exec_ctx_t &ctx) const {
-    const auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    const auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
 
     const int OD = pd()->OD();
     const int OH = pd()->OH();
@@ -162,6 +177,14 @@ void simple_resampling_fwd_t<data_type>::execute_forward(
 
 template struct simple_resampling_fwd_t<data_type::f32>;
 template struct simple_resampling_fwd_t<data_type::bf16>;
+template struct simple_resampling_fwd_t<data_type::f32, data_type::s8>;
+template struct simple_resampling_fwd_t<data_type::f32, data_type::u8>;
+template struct simple_resampling_fwd_t<data_type::s8, data_type::f32>;
+template struct simple_resampling_fwd_t<data_type::s8, data_type::s8>;
+template struct simple_resampling_fwd_t<data_type::s8, data_type::u8>;
+template struct simple_resampling_fwd_t<data_type::u8, data_type::f32>;
+template struct simple_resampling_fwd_t<data_type::u8, data_type::s8>;
+template struct simple_resampling_fwd_t<data_type::u8, data_type::u8>;
 
 template <impl::data_type_t data_type>
 simple_resampling_bwd_t<data_type>::simple_resampling_bwd_t(const pd_t *apd)
@@ -18,6 +18,7 @@
 #define CPU_SIMPLE_RESAMPLING_HPP
 
 #include <assert.h>
+#include <memory>
 
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
@@ -27,13 +28,15 @@
 #include "cpu/platform.hpp"
 
 #include "cpu/cpu_resampling_pd.hpp"
+#include "cpu/ref_eltwise.hpp"
 #include "cpu/resampling_utils.hpp"
+#include "cpu/simple_q10n.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
-template <impl::data_type_t data_type>
+template <impl::data_type_t src_type, impl::data_type_t dst_type = src_type>
 struct simple_resampling_fwd_t : public primitive_t {
     struct pd_t : public cpu_resampling_fwd_pd_t {
         using cpu_resampling_fwd_pd_t::cpu_resampling_fwd_pd_t;
@@ -44,11 +47,11 @@ struct simple_resampling_fwd_t : public primitive_t {
             using namespace format_tag;
             using namespace data_type;
             bool ok = is_fwd() && !has_zero_dim_memory()
-                    && utils::everyone_is(
-                            data_type, src_md()->data_type, dst_md()->data_type)
-                    && platform::has_data_type_support(data_type)
-                    && set_default_params() == status::success
-                    && attr()->has_default_values();
+                    && src_md()->data_type == src_type
+                    && dst_md()->data_type == dst_type
+                    && platform::has_data_type_support(src_type)
+                    && platform::has_data_type_support(dst_type)
+                    && set_default_params() == status::success && attr_ok();
             if (!ok) return status::unimplemented;
 
             format_tag_t dat_tag = memory_desc_matches_one_of_tag(*src_md(),
@@ -64,7 +67,8 @@ struct simple_resampling_fwd_t : public primitive_t {
     simple_resampling_fwd_t(const pd_t *apd);
     ~simple_resampling_fwd_t();
 
-    typedef typename prec_traits<data_type>::type data_t;
+    typedef typename prec_traits<src_type>::type src_data_t;
+    typedef typename prec_traits<dst_type>::type dst_data_t;
 
     status_t execute(const exec_ctx_t &ctx) const override {
         execute_forward(ctx);
@@ -73,25 +77,46 @@ struct simple_resampling_fwd_t : public primitive_t {
 
 private:
     void fill_coeffs();
-    void nearest(
-            const data_t *src, data_t *dst, dim_t od, dim_t oh, dim_t ow) const;
-    void linear(
-            const data_t *src, data_t *dst, dim_t od, dim_t oh, dim_t ow) const;
-    void bilinear(
-            const data_t *src, data_t *dst, dim_t od, dim_t oh, dim_t ow) const;
-    void trilinear(
-            const data_t *src, data_t *dst, dim_t od, dim_t oh, dim_t ow) const;
-    void (simple_resampling_fwd_t::*interpolate)(
-            const data_t *src, data_t *dst, dim_t od, dim_t oh, dim_t ow) const;
+    void nearest(const src_data_t *src, dst_data_t *dst, dim_t od, dim_t oh,
+            dim_t ow) const;
+    void linear(const src_data_t *src, dst_data_t *dst, dim_t od, dim_t oh,
+            dim_t ow) const;
+    void bilinear(const src_data_t *src, dst_data_t *dst, dim_t od, dim_t oh,
+            dim_t ow) const;
+    void trilinear(const src_data_t *src, dst_data_t *dst, dim_t od, dim_t oh,
+            dim_t ow) const;
+    void (simple_resampling_fwd_t::*interpolate)(const src_data_t *src,
+            dst_data_t *dst, dim_t od, dim_t oh, dim_t ow) const;
     void execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
+    // applies the output scale and the post-ops to the interpolated value,
+    // prev_dst is the value to be overwritten, used by the sum post-op
+    dst_data_t finalize(float d, dst_data_t prev_dst) const {
+        if (with_attr_) {
+            d *= oscale_;
+            const auto &po = pd()->attr()->post_ops_;
+            for (int idx = 0; idx < po.len_; ++idx) {
+                const auto &e = po.entry_[idx];
+                if (e.kind == primitive_kind::sum)
+                    d += e.sum.scale * (float)prev_dst;
+                else
+                    d = eltwises_[idx]->compute_scalar(d);
+            }
+        }
+        return cpu::saturate_and_round<dst_data_t>(d);
+    }
+
     dim_t nsp_outer_;
     dim_t stride_d_;
     dim_t stride_h_;
     dim_t stride_w_;
     dim_t inner_stride_;
     std::vector<resampling_utils::linear_coeffs_t> linear_coeffs_;
+    bool with_attr_;
+    float oscale_;
+    std::unique_ptr<ref_eltwise_scalar_fwd_t>
+            eltwises_[dnnl_post_ops::capacity];
 };
 
 template <impl::data_type_t data_type>
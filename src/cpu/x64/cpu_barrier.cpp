@@ -16,6 +16,8 @@
 
 #include <assert.h>
 
+#include "common/thread_profiling.hpp"
+
 #include "cpu/x64/cpu_barrier.hpp"
 
 namespace dnnl {
@@ -101,6 +103,8 @@ struct jit_t : public jit_generator {
 
 void barrier(ctx_t *ctx, int nthr) {
     static jit_t j; /* XXX: constructed on load ... */
+    thread_profiling::event_scope_t prof_scope(
+            thread_profiling::event_t::barrier);
     j.barrier(ctx, nthr);
 }
 
@@ -220,6 +220,8 @@ struct cpu_reducer_t {
         simple_barrier::barrier(
                 &bctx[balancer().group_id(ithr)], balancer().nthr_per_group_);
 
+        thread_profiling::event_scope_t prof_scope(
+                thread_profiling::event_t::reduction);
         reduce_nolock(ithr, dst, scratchpad);
     }
 
@@ -297,6 +299,8 @@ struct cpu_reducer_2d_t {
         simple_barrier::barrier(
                 &bctx[balancer().group_id(ithr)], balancer().nthr_per_group_);
 
+        thread_profiling::event_scope_t prof_scope(
+                thread_profiling::event_t::reduction);
         reduce_nolock(ithr, dst, scratchpad);
     }
 
@@ -0,0 +1,364 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/gemm/gemm.hpp"
+
+#include "cpu/x64/jit_avx2_f32_wino_conv.hpp"
+#include "cpu/x64/wino_conv_cost_model.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+// number of channels processed at once by the transforms
+const int simd_w = 8;
+
+// source and destination transform matrices of F(m x m, 3 x 3)
+template <int m>
+struct wino_matrices_t;
+
+template <>
+struct wino_matrices_t<2> {
+    static constexpr int alpha = 4;
+    static constexpr float Bt[alpha][alpha] = {
+            {1, 0, -1, 0}, {0, 1, 1, 0}, {0, -1, 1, 0}, {0, 1, 0, -1}};
+    static constexpr float At[2][alpha] = {{1, 1, 1, 0}, {0, 1, -1, -1}};
+};
+constexpr float wino_matrices_t<2>::Bt[4][4];
+constexpr float wino_matrices_t<2>::At[2][4];
+
+template <>
+struct wino_matrices_t<4> {
+    static constexpr int alpha = 6;
+    static constexpr float Bt[alpha][alpha] = {{4, 0, -5, 0, 1, 0},
+            {0, -4, -4, 1, 1, 0}, {0, 4, -4, -1, 1, 0}, {0, -2, -1, 2, 1, 0},
+            {0, 2, -1, -2, 1, 0}, {0, 4, 0, -5, 0, 1}};
+    static constexpr float At[4][alpha] = {{1, 1, 1, 1, 1, 0},
+            {0, 1, -1, 2, -2, 0}, {0, 1, 1, 4, 4, 0}, {0, 1, -1, 8, -8, 1}};
+};
+constexpr float wino_matrices_t<4>::Bt[6][6];
+constexpr float wino_matrices_t<4>::At[4][6];
+} // namespace
+
+status_t jit_avx2_f32_wino_conv_fwd_t::pd_t::init_conf(
+        memory_desc_t &expect_wei_md) {
+    const convolution_desc_t &cd = *desc();
+    const memory_desc_wrapper src_d(&src_md_);
+    const memory_desc_wrapper wei_d(&weights_md_);
+    const memory_desc_wrapper dst_d(&dst_md_);
+
+    auto &jcp = jcp_;
+
+    if (!mayiuse(avx2)) return status::unimplemented;
+
+    // 2D convolutions without groups only
+    if (src_d.ndims() != 4 || wei_d.ndims() != 4) return status::unimplemented;
+
+    jcp.nthr = dnnl_get_max_threads();
+    jcp.mb = src_d.dims()[0];
+    jcp.ic_without_padding = src_d.dims()[1];
+    jcp.oc_without_padding = dst_d.dims()[1];
+    jcp.ic = rnd_up(jcp.ic_without_padding, simd_w);
+    jcp.oc = rnd_up(jcp.oc_without_padding, simd_w);
+    jcp.ih = src_d.dims()[2];
+    jcp.iw = src_d.dims()[3];
+    jcp.oh = dst_d.dims()[2];
+    jcp.ow = dst_d.dims()[3];
+    jcp.t_pad = cd.padding[0][0];
+    jcp.l_pad = cd.padding[0][1];
+    jcp.with_bias = cd.bias_desc.format_kind != format_kind::undef;
+
+    const bool shape_ok = true && wei_d.dims()[2] == 3 && wei_d.dims()[3] == 3
+            && cd.strides[0] == 1 && cd.strides[1] == 1
+            && cd.dilates[0] == 0 && cd.dilates[1] == 0;
+    if (!shape_ok) return status::unimplemented;
+
+    const auto dat_tag = src_d.matches_one_of_tag(nChw8c, nhwc);
+    if (dat_tag == format_tag::undef || !dst_d.matches_tag(dat_tag))
+        return status::unimplemented;
+    jcp.is_nhwc = dat_tag == nhwc;
+
+    // F(4x4, 3x3) saves more multiplications per output point, unless the
+    // output is so small that most of its tiles are padding
+    auto tile_work = [&](int m) {
+        return (size_t)div_up(jcp.oh, m) * div_up(jcp.ow, m) * (m + 2)
+                * (m + 2);
+    };
+    jcp.m = tile_work(4) <= tile_work(2) ? 4 : 2;
+    jcp.r = 3;
+    jcp.alpha = jcp.m + jcp.r - 1;
+    jcp.tiles_h = div_up(jcp.oh, jcp.m);
+    jcp.tiles_w = div_up(jcp.ow, jcp.m);
+    jcp.ntiles = jcp.mb * jcp.tiles_h * jcp.tiles_w;
+
+    if (!IMPLICATION(cd.alg_kind == alg_kind::convolution_auto,
+                wino_conv_cost_model::is_winograd_faster_than_direct(
+                        cd, jcp.m, avx2, jcp.nthr)))
+        return status::unimplemented;
+
+    // the transformed source and the products of a tile block stay in L2
+    const size_t L2 = platform::get_per_core_cache_size(2);
+    const size_t tile_size
+            = sizeof(float) * jcp.alpha * jcp.alpha * (jcp.ic + jcp.oc);
+    jcp.tile_block = saturate(16, 64, (int)(L2 / tile_size));
+    jcp.tile_block = nstl::max(
+            1, nstl::min(jcp.tile_block, div_up(jcp.ntiles, jcp.nthr)));
+    jcp.nb_tile_blocks = div_up(jcp.ntiles, jcp.tile_block);
+
+    if (!one_of(wei_d.format_kind(), format_kind::any, format_kind::wino))
+        return status::unimplemented;
+
+    expect_wei_md.format_kind = format_kind::wino;
+    expect_wei_md.data_type = data_type::f32;
+    dnnl_wino_desc_t &wd = expect_wei_md.format_desc.wino_desc;
+    wd.wino_format = dnnl_wino_wei_aaIO;
+    wd.r = jcp.r;
+    wd.alpha = jcp.alpha;
+    wd.ic = jcp.ic;
+    wd.oc = jcp.oc;
+    wd.ic_block = jcp.ic;
+    wd.oc_block = jcp.oc;
+    wd.ic2_block = 1;
+    wd.oc2_block = 1;
+    wd.adj_scale = 1.f;
+    wd.size = sizeof(float) * jcp.alpha * jcp.alpha * jcp.ic * jcp.oc;
+
+    return status::success;
+}
+
+void jit_avx2_f32_wino_conv_fwd_t::pd_t::init_scratchpad() {
+    const auto &jcp = jcp_;
+    const size_t block_size = (size_t)jcp.alpha * jcp.alpha * jcp.tile_block;
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<float>(key_wino_V, jcp.nthr * block_size * jcp.ic);
+    scratchpad.book<float>(key_wino_M, jcp.nthr * block_size * jcp.oc);
+}
+
+template <int m>
+status_t jit_avx2_f32_wino_conv_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    using mat = wino_matrices_t<m>;
+    constexpr int alpha = mat::alpha;
+
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto &jcp = pd()->jcp_;
+    assert(jcp.m == m && jcp.alpha == alpha);
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *V_base = scratchpad.get<float>(key_wino_V);
+    float *M_base = scratchpad.get<float>(key_wino_M);
+
+    const dim_t T = jcp.tile_block;
+    const dim_t IC = jcp.ic;
+    const dim_t OC = jcp.oc;
+    const int nb_ic = jcp.ic / simd_w;
+    const int nb_oc = jcp.oc / simd_w;
+    const bool with_sum = sum_scale_ != 0.f;
+
+    // The nhwc data is addressed by the channel, and its last channel block
+    // may be incomplete. The padded channels of nChw8c are processed as the
+    // regular ones.
+    auto blk_idx = [&](int cb) { return jcp.is_nhwc ? cb * simd_w : cb; };
+    auto blk_len = [&](int cb, int C) {
+        return jcp.is_nhwc ? nstl::min(simd_w, C - cb * simd_w) : simd_w;
+    };
+
+    // the tiles are numbered in the (mb, tiles_h, tiles_w) order
+    auto tile_coords = [&](int tile, int &n, int &oh0, int &ow0) {
+        ow0 = (tile % jcp.tiles_w) * m;
+        tile /= jcp.tiles_w;
+        oh0 = (tile % jcp.tiles_h) * m;
+        n = tile / jcp.tiles_h;
+    };
+
+    // V[alpha * alpha][T][IC] = Bt * d * B for every tile of the block
+    auto src_transform = [&](float *V, int tile_start, int tile_end) {
+        for (int tile = tile_start; tile < tile_end; ++tile) {
+            int n, oh0, ow0;
+            tile_coords(tile, n, oh0, ow0);
+            const int ih0 = oh0 - jcp.t_pad;
+            const int iw0 = ow0 - jcp.l_pad;
+            const dim_t t = tile - tile_start;
+
+            for (int icb = 0; icb < nb_ic; ++icb) {
+                const int ic_len = blk_len(icb, jcp.ic_without_padding);
+                float d[alpha][alpha][simd_w];
+                for_(int i = 0; i < alpha; ++i)
+                for (int j = 0; j < alpha; ++j) {
+                    const int ih = ih0 + i;
+                    const int iw = iw0 + j;
+                    const bool in_bounds
+                            = 0 <= ih && ih < jcp.ih && 0 <= iw && iw < jcp.iw;
+                    const float *s = in_bounds
+                            ? &src[src_d.blk_off(n, blk_idx(icb), ih, iw)]
+                            : nullptr;
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < simd_w; ++c)
+                        d[i][j][c] = in_bounds && c < ic_len ? s[c] : 0.f;
+                }
+
+                float tmp[alpha][alpha][simd_w];
+                for_(int i = 0; i < alpha; ++i)
+                for (int j = 0; j < alpha; ++j) {
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < simd_w; ++c) {
+                        float acc = 0.f;
+                        for (int k = 0; k < alpha; ++k)
+                            acc += mat::Bt[i][k] * d[k][j][c];
+                        tmp[i][j][c] = acc;
+                    }
+                }
+
+                for_(int i = 0; i < alpha; ++i)
+                for (int j = 0; j < alpha; ++j) {
+                    float *v = &V[((i * alpha + j) * T + t) * IC
+                            + icb * simd_w];
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < simd_w; ++c) {
+                        float acc = 0.f;
+                        for (int k = 0; k < alpha; ++k)
+                            acc += tmp[i][k][c] * mat::Bt[j][k];
+                        v[c] = acc;
+                    }
+                }
+            }
+        }
+    };
+
+    // dst = At * M * A with bias and post-ops for every tile of the block
+    auto dst_transform = [&](const float *M, int tile_start, int tile_end) {
+        for (int tile = tile_start; tile < tile_end; ++tile) {
+            int n, oh0, ow0;
+            tile_coords(tile, n, oh0, ow0);
+            const dim_t t = tile - tile_start;
+
+            for (int ocb = 0; ocb < nb_oc; ++ocb) {
+                const int oc_len = nstl::min(
+                        simd_w, jcp.oc_without_padding - ocb * simd_w);
+                float tmp[m][alpha][simd_w];
+                for_(int i = 0; i < m; ++i)
+                for (int j = 0; j < alpha; ++j) {
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < simd_w; ++c) {
+                        float acc = 0.f;
+                        for (int k = 0; k < alpha; ++k)
+                            acc += mat::At[i][k]
+                                    * M[((k * alpha + j) * T + t) * OC
+                                            + ocb * simd_w + c];
+                        tmp[i][j][c] = acc;
+                    }
+                }
+
+                float b[simd_w];
+                for (int c = 0; c < simd_w; ++c) {
+                    const int oc = ocb * simd_w + c;
+                    b[c] = jcp.with_bias && oc < jcp.oc_without_padding
+                            ? bias[oc]
+                            : 0.f;
+                }
+
+                for_(int i = 0; i < m; ++i)
+                for (int j = 0; j < m; ++j) {
+                    const int oh = oh0 + i;
+                    const int ow = ow0 + j;
+                    if (oh >= jcp.oh || ow >= jcp.ow) continue;
+
+                    float y[simd_w];
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < simd_w; ++c) {
+                        float acc = b[c];
+                        for (int k = 0; k < alpha; ++k)
+                            acc += tmp[i][k][c] * mat::At[j][k];
+                        y[c] = acc;
+                    }
+
+                    float *d = &dst[dst_d.blk_off(n, blk_idx(ocb), oh, ow)];
+                    for (int c = 0; c < oc_len; ++c) {
+                        if (with_sum) y[c] += sum_scale_ * d[c];
+                        if (eltwise_) y[c] = eltwise_->compute_scalar(y[c]);
+                        d[c] = y[c];
+                    }
+                    // keep the padded channels of nChw8c zero
+                    if (!jcp.is_nhwc)
+                        for (int c = oc_len; c < simd_w; ++c)
+                            d[c] = 0.f;
+                }
+            }
+        }
+    };
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        int start {0}, end {0};
+        balance211(jcp.nb_tile_blocks, nthr, ithr, start, end);
+
+        float *V = V_base + (size_t)ithr * alpha * alpha * T * IC;
+        float *M = M_base + (size_t)ithr * alpha * alpha * T * OC;
+
+        for (int tb = start; tb < end; ++tb) {
+            const int tile_start = tb * jcp.tile_block;
+            const int tile_end
+                    = nstl::min(tile_start + jcp.tile_block, jcp.ntiles);
+            const dim_t ntiles = tile_end - tile_start;
+
+            src_transform(V, tile_start, tile_end);
+
+            // M[a] = U[a] * V[a], where U[a] is the IC x OC matrix of the
+            // transformed weights, all the matrices are column-major
+            const float one = 1.f, zero = 0.f;
+            for (int a = 0; a < alpha * alpha; ++a)
+                extended_sgemm("N", "N", &OC, &ntiles, &IC, &one,
+                        &weights[(size_t)a * IC * OC], &OC, &V[a * T * IC],
+                        &IC, &zero, &M[a * T * OC], &OC);
+
+            dst_transform(M, tile_start, tile_end);
+        }
+    });
+
+    return status::success;
+}
+
+template status_t jit_avx2_f32_wino_conv_fwd_t::execute_forward<2>(
+        const exec_ctx_t &ctx) const;
+template status_t jit_avx2_f32_wino_conv_fwd_t::execute_forward<4>(
+        const exec_ctx_t &ctx) const;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,159 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_AVX2_F32_WINO_CONV_HPP
+#define CPU_X64_JIT_AVX2_F32_WINO_CONV_HPP
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/ref_eltwise.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_avx2_f32_wino_conf_t {
+    int nthr;
+    int mb, ic, oc, ic_without_padding, oc_without_padding;
+    int ih, iw, oh, ow;
+    int t_pad, l_pad;
+    // output tile size, kernel size and input tile size
+    int m, r, alpha;
+    int tiles_h, tiles_w, ntiles;
+    // number of tiles transformed and multiplied at once by a thread
+    int tile_block, nb_tile_blocks;
+    bool with_bias;
+    bool is_nhwc;
+};
+
+/* Forward Winograd F(2x2, 3x3) and F(4x4, 3x3) convolution for AVX2.
+ *
+ * A thread takes a block of output tiles and transforms the corresponding
+ * source tiles of all the input channels into V[alpha * alpha][tile][ic].
+ * The alpha * alpha independent products M = V * U, where U is the weights
+ * transformed by the reorder into U[alpha * alpha][ic][oc], are computed by
+ * the jit sgemm and transformed back into the destination tiles. The
+ * transforms work on 8 channels at once, which are either a nChw8c block or
+ * a part of the nhwc point. */
+struct jit_avx2_f32_wino_conv_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd), jcp_() {}
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit_fp32_wino:", avx2, ""),
+                jit_avx2_f32_wino_conv_fwd_t);
+
+        status_t init(engine_t *engine) {
+            bool ok = true && is_fwd()
+                    && utils::one_of(desc()->alg_kind,
+                            alg_kind::convolution_auto,
+                            alg_kind::convolution_winograd)
+                    && expect_data_types(data_type::f32, data_type::f32,
+                            data_type::f32, data_type::f32, data_type::f32)
+                    && !has_zero_dim_memory()
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops)
+                    && post_ops_ok() && set_default_formats();
+            if (!ok) return status::unimplemented;
+
+            memory_desc_t expect_wei_md = *weights_md();
+            CHECK(init_conf(expect_wei_md));
+            set_default_alg_kind(alg_kind::convolution_winograd);
+
+            if (weights_md_.format_kind == format_kind::any)
+                weights_md_ = expect_wei_md;
+            if (weights_md_ != expect_wei_md) return status::unimplemented;
+
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        jit_avx2_f32_wino_conf_t jcp_;
+
+    protected:
+        status_t init_conf(memory_desc_t &expect_wei_md);
+        void init_scratchpad();
+
+        bool post_ops_ok() const {
+            auto const &po = attr()->post_ops_;
+            auto is_eltwise
+                    = [&](int idx) { return po.entry_[idx].is_eltwise(); };
+            auto is_sum = [&](int idx) { return po.entry_[idx].is_sum(false); };
+
+            switch (po.len_) {
+                case 0: return true; // no post_ops
+                case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
+                case 2: return is_sum(0) && is_eltwise(1); // sum -> eltwise
+                default: return false;
+            }
+            return false;
+        }
+
+        bool set_default_formats() {
+            using namespace format_tag;
+            return set_default_formats_common(nChw8c, any, nChw8c);
+        }
+    };
+
+    jit_avx2_f32_wino_conv_fwd_t(const pd_t *apd)
+        : primitive_t(apd), eltwise_(nullptr) {
+        const auto &po = pd()->attr()->post_ops_;
+        const int sum_idx = po.find(primitive_kind::sum);
+        sum_scale_ = sum_idx != -1 ? po.entry_[sum_idx].sum.scale : 0.f;
+
+        const int eltwise_idx = po.find(primitive_kind::eltwise);
+        if (eltwise_idx != -1)
+            eltwise_ = new ref_eltwise_scalar_fwd_t(
+                    po.entry_[eltwise_idx].eltwise);
+    }
+
+    ~jit_avx2_f32_wino_conv_fwd_t() { delete eltwise_; }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return pd()->jcp_.m == 4 ? execute_forward<4>(ctx)
+                                 : execute_forward<2>(ctx);
+    }
+
+private:
+    template <int m>
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    float sum_scale_;
+    ref_eltwise_scalar_fwd_t *eltwise_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
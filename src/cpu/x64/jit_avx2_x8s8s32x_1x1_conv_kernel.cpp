@@ -24,6 +24,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/platform.hpp"
+#include "cpu/zero_point_utils.hpp"
 
 #include "cpu/x64/jit_avx2_x8s8s32x_1x1_conv_kernel.hpp"
 #include "cpu/x64/jit_uni_1x1_conv_utils.hpp"
@@ -182,7 +183,7 @@ void jit_avx2_x8s8s32x_1x1_conv_kernel::reduce_loop(
             auto ymm_bias = ymm_tmp;
             auto ymm_comp = ymm_bcast;
             if (jcp.with_bias) {
-                if (jcp.signed_input)
+                if (with_compensation())
                     mov(reg_bias_data, ptr[rsp + reg_bias_data_off]);
                 cvt2ps(jcp.bia_dt, ymm_bias, reg_bias_data,
                         jcp.typesize_bia * jcp.oc_block * i_load,
@@ -190,7 +191,7 @@ void jit_avx2_x8s8s32x_1x1_conv_kernel::reduce_loop(
                 if (jcp.signed_input)
                     vmulps(ymm_bias, ymm_bias, ymm_bias_alpha());
             }
-            if (jcp.signed_input) {
+            if (with_compensation()) {
                 mov(reg_comp_data, ptr[rsp + reg_comp_data_off]);
                 cvt2ps(data_type::s32, ymm_comp, reg_comp_data,
                         sizeof(int32_t) * jcp.oc_block * i_load,
@@ -200,7 +201,7 @@ void jit_avx2_x8s8s32x_1x1_conv_kernel::reduce_loop(
             for (int i_ur = 0; i_ur < ur; ++i_ur) {
                 auto r = vreg_accum(i_load, i_ur);
                 vcvtdq2ps(r, r);
-                if (jcp.signed_input) vaddps(r, r, ymm_comp);
+                if (with_compensation()) vaddps(r, r, ymm_comp);
                 if (jcp.with_bias) vaddps(r, r, ymm_bias);
 
                 const auto ptr_scales_offset = jcp.is_oc_scale
@@ -243,6 +244,19 @@ void jit_avx2_x8s8s32x_1x1_conv_kernel::reduce_loop(
         if (maybe_eltwise(1))
             eltwise_injector_->compute_vector_range(0, ur * load_loop_blk);
 
+        if (jcp.dst_zero_point) {
+            const float dst_zp = (float)*attr_.zero_points_.get(DNNL_ARG_DST);
+            auto xmm_dst_zp = Xmm(ymm_dst_zp.getIdx());
+            mov(reg_store_bcast, float2int(dst_zp));
+            vmovq(xmm_dst_zp, reg_store_bcast);
+            vbroadcastss(ymm_dst_zp, xmm_dst_zp);
+            for (int i_load = 0; i_load < load_loop_blk; ++i_load)
+                for (int i_ur = 0; i_ur < ur; ++i_ur) {
+                    auto r = vreg_accum(i_load, i_ur);
+                    vaddps(r, r, ymm_dst_zp);
+                }
+        }
+
         // Properly saturate the accumulators for integer datatypes
         if (utils::one_of(jcp.dst_dt, u8, s8, s32)) {
             init_saturate_f32(ymm_zero, ymm_saturation, aux_reg_saturation, f32,
@@ -369,7 +383,7 @@ void jit_avx2_x8s8s32x_1x1_conv_kernel::generate() {
     sub(rsp, stack_space_needed);
 
     if (jcp.with_bias) mov(reg_bias_data, ptr[param1 + GET_OFF(bias_data)]);
-    if (jcp.signed_input) {
+    if (with_compensation()) {
         mov(ptr[rsp + reg_bias_data_off], reg_bias_data);
         mov(reg_comp_data, ptr[param1 + GET_OFF(compensation)]);
         mov(ptr[rsp + reg_comp_data_off], reg_comp_data);
@@ -390,14 +404,14 @@ void jit_avx2_x8s8s32x_1x1_conv_kernel::generate() {
         bcast_loop(load_loop_blk);
         add(reg_load_data, load_loop_blk * jcp.load_loop_load_step);
         if (jcp.with_bias) {
-            if (jcp.signed_input)
+            if (with_compensation())
                 mov(reg_bias_data, ptr[rsp + reg_bias_data_off]);
             add(reg_bias_data,
                     load_loop_blk * jcp.load_block * jcp.typesize_bia);
-            if (jcp.signed_input)
+            if (with_compensation())
                 mov(ptr[rsp + reg_bias_data_off], reg_bias_data);
         }
-        if (jcp.signed_input) {
+        if (with_compensation()) {
             mov(reg_comp_data, ptr[rsp + reg_comp_data_off]);
             add(reg_comp_data,
                     load_loop_blk * jcp.load_block * sizeof(int32_t));
@@ -541,6 +555,15 @@ status_t jit_avx2_x8s8s32x_1x1_conv_kernel::init_conf(jit_1x1_conv_conf_t &jcp,
     jcp.with_eltwise = eltwise_ind != -1;
     if (jcp.with_eltwise) jcp.eltwise = p.entry_[eltwise_ind].eltwise;
 
+    if (!zero_point_utils::conv_zero_points_ok(attr, src_d.data_type()))
+        return status::unimplemented;
+    jcp.src_zero_point = !attr.zero_points_.has_default_values(DNNL_ARG_SRC);
+    jcp.dst_zero_point = !attr.zero_points_.has_default_values(DNNL_ARG_DST);
+    // the fused depthwise convolution would need the zero point of the
+    // intermediate result
+    if ((jcp.src_zero_point || jcp.dst_zero_point) && jcp.with_dw_conv)
+        return status::unimplemented;
+
     format_tag_t dat_tag = utils::pick(
             ndims - 3, format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
     jcp.src_tag = src_d.matches_one_of_tag(dat_tag);
@@ -748,9 +771,14 @@ void jit_avx2_x8s8s32x_1x1_conv_kernel::init_scratchpad(
     using namespace dnnl::impl::memory_tracking::names;
 
     if (jcp.signed_input) {
-        dim_t count = nstl::max<dim_t>(attr.output_scales_.count_, 8);
+        const dim_t oc = jcp.is_oc_scale ? jcp.ngroups * jcp.oc_without_padding
+                                         : 1;
+        const dim_t count = nstl::max<dim_t>(oc, 8);
         scratchpad.book<float>(key_conv_adjusted_scales, count);
     }
+    if (jcp.src_zero_point)
+        scratchpad.book<int32_t>(
+                key_conv_src_zp_compensation, jcp.ngroups * jcp.oc);
 }
 
 } // namespace x64
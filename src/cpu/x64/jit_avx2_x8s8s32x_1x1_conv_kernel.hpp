@@ -57,6 +57,10 @@ struct jit_avx2_x8s8s32x_1x1_conv_kernel : public jit_generator {
             const jit_1x1_conv_conf_t &jcp, const primitive_attr_t &attr);
 
     bool maybe_eltwise(int position);
+    // the s8 source and the src zero point are corrected by the compensation
+    bool with_compensation() const {
+        return jcp.signed_input || jcp.src_zero_point;
+    }
 
     int get_tail_size() { return jcp.oc_without_padding % jcp.oc_block; }
 
@@ -92,6 +96,7 @@ private:
     const Xbyak::Ymm ymm_one = Xbyak::Ymm(13);
     const Xbyak::Ymm ymm_zero = Xbyak::Ymm(14);
     const Xbyak::Ymm ymm_shift = Xbyak::Ymm(14);
+    const Xbyak::Ymm ymm_dst_zp = Xbyak::Ymm(14);
     const Xbyak::Ymm ymm_bcast = Xbyak::Ymm(15);
     const Xbyak::Ymm ymm_saturation = Xbyak::Ymm(15);
 
@@ -72,7 +72,8 @@ struct jit_avx2_x8s8s32x_1x1_convolution_fwd_t : public primitive_t {
                                     data_type::f32, data_type::s32,
                                     data_type::s8, data_type::u8))
                     && attr()->has_default_values(
-                            primitive_attr_t::skip_mask_t::oscale
+                            primitive_attr_t::skip_mask_t::oscale_runtime
+                            | primitive_attr_t::skip_mask_t::zero_points
                             | primitive_attr_t::skip_mask_t::post_ops)
                     && !has_zero_dim_memory()
                     && set_default_formats_common(
@@ -299,8 +300,12 @@ struct jit_avx2_x8s8s32x_1x1_convolution_fwd_t : public primitive_t {
             jcp_dw_->is_fused_conv = true;
             // TODO: Support/experiment arbitary oc_work in dw conv.
             // Until then we keep ch_work perfectly divisible.
-            while (jcp_1x1.nb_load % jcp_1x1.nb_load_blocking != 0)
-                --jcp_1x1.nb_load_blocking;
+            const size_t dw_row_block_size = (size_t)jcp_dw_->kh * jcp_dw_->iw
+                    * jcp_1x1.oc_block
+                    * types::data_type_size(dw_conv_pd_->src_md()->data_type);
+            jcp_1x1.nb_load_blocking = get_dw_conv_load_blocking(
+                    jcp_1x1.nb_load, jcp_1x1.nb_load_blocking,
+                    dw_row_block_size);
             jcp_1x1.nb_load_blocking_max = jcp_1x1.nb_load_blocking;
 
             while (jcp_1x1.nb_load_blocking % jcp_dw_->nb_ch_blocking != 0)
@@ -363,15 +368,15 @@ struct jit_avx2_x8s8s32x_1x1_convolution_fwd_t : public primitive_t {
     typedef typename prec_traits<data_type::s32>::type acc_data_t;
 
     status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
-        return status::success;
+        return execute_forward(ctx);
     }
 
 private:
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
     void execute_forward_thr(const int ithr, const int nthr,
             const src_data_t *src, const wei_data_t *weights, const char *bias,
             const wei_data_t *weights_dw, const char *bias_dw, dst_data_t *dst,
+            const float *oscales,
             const memory_tracking::grantor_t &scratchpad) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
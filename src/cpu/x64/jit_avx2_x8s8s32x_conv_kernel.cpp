@@ -21,6 +21,8 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/zero_point_utils.hpp"
+
 #include "cpu/x64/jit_avx2_x8s8s32x_conv_kernel.hpp"
 
 #define GET_OFF(field) offsetof(jit_conv_call_s, field)
@@ -54,9 +56,14 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Vmm>::prepare_output(int ur_w) {
             Vmm vmm = vmm_out(j, k);
             vpxor(vmm, vmm, vmm);
         }
-    if (jcp.signed_input) {
+    if (use_shift()) {
+        // the padded taps are computed with the shifted zero for the signed
+        // input and with the src zero point otherwise
+        const int shift = jcp.signed_input
+                ? 128
+                : *attr_.zero_points_.get(DNNL_ARG_SRC);
         auto xmm_shift = Xbyak::Xmm(vmm_shift.getIdx());
-        mov(reg_scratch, 128);
+        mov(reg_scratch, shift);
         vmovq(xmm_shift, reg_scratch);
         if (jcp.is_depthwise)
             vpbroadcastd(vmm_shift, xmm_shift);
@@ -93,7 +100,7 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Vmm>::store_output(
 
     mov(reg_bias, ptr[param1 + GET_OFF(bias)]);
     mov(reg_ptr_scales, ptr[param1 + GET_OFF(scales)]);
-    if (jcp.signed_input)
+    if (use_shift())
         mov(reg_compensation, ptr[param1 + GET_OFF(compensation)]);
 
     const auto &p = attr_.post_ops_;
@@ -125,7 +132,7 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Vmm>::store_output(
             if (jcp.signed_input) /* bias *= 0.5 */
                 vmulps(vmm_bias, vmm_bias, vmm_bias_alpha());
         }
-        if (jcp.signed_input) {
+        if (use_shift()) {
             int comp_offset = sizeof(int32_t) * k * oc_block;
             cvt2ps(data_type::s32, vmm_comp, reg_compensation, comp_offset,
                     mask_flag ? get_tail_size() : get_blocking_size());
@@ -135,7 +142,7 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Vmm>::store_output(
             Vmm vmm = vmm_out(j, k);
 
             vcvtdq2ps(vmm, vmm);
-            if (jcp.signed_input) vaddps(vmm, vmm, vmm_comp);
+            if (use_shift()) vaddps(vmm, vmm, vmm_comp);
             if (jcp.with_bias) vaddps(vmm, vmm, vmm_bias);
 
             if (mask_flag) {
@@ -172,6 +179,17 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Vmm>::store_output(
     }
     if (maybe_eltwise(1)) compute_eltwise(ur_w);
 
+    if (jcp.dst_zero_point) {
+        const float dst_zp = (float)*attr_.zero_points_.get(DNNL_ARG_DST);
+        Xmm xmm_dst_zp(vmm_dst_zp.getIdx());
+        mov(reg_ptr_saturation_ubound, float2int(dst_zp));
+        vmovq(xmm_dst_zp, reg_ptr_saturation_ubound);
+        vbroadcastss(vmm_dst_zp, xmm_dst_zp);
+        for (int k = 0; k < nb_oc_block; ++k)
+            for (int j = 0; j < ur_w; ++j)
+                vaddps(vmm_out(j, k), vmm_out(j, k), vmm_dst_zp);
+    }
+
     // Properly saturate the accumulators for integer datatypes
 
     // No need to saturate on lower bound for signed integer types, as
@@ -276,7 +294,7 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Ymm>::compute_ker_dw(int ur_w, int pad_l,
         }
     }
 
-    if (jcp.signed_input) vmovups(ymm_shifted_zero, vmm_shift);
+    if (use_shift()) vmovups(ymm_shifted_zero, vmm_shift);
 
     for (int ci = 0; ci < jcp.nb_ch_blocking; ++ci) {
         const bool mask_flag = last_ic_block_flag != no_last_block
@@ -300,14 +318,14 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Ymm>::compute_ker_dw(int ur_w, int pad_l,
 
             vpmovsxbd(ymm_wei, ptr[aux_reg_ker + aux_kernel_offset]);
             if (h_padded) {
-                assert(jcp.signed_input);
+                assert(use_shift());
                 for (int oi = 0; oi < ur_w; ++oi)
                     compute(vmm_out(oi, ci), ymm_wei, ymm_shifted_zero);
             } else {
                 int oi_start = get_ow_start(ki, pad_l);
                 int oi_end = get_ow_end(ur_w, ki, pad_r);
-                int start_ = jcp.signed_input ? 0 : oi_start;
-                int end_ = jcp.signed_input ? ur_w : oi_end;
+                int start_ = use_shift() ? 0 : oi_start;
+                int end_ = use_shift() ? ur_w : oi_end;
                 for (int oi = start_; oi < end_; ++oi) {
                     if (oi >= oi_start && oi < oi_end) {
                         if (jcp.is_resrc_depthwise) {
@@ -324,7 +342,7 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Ymm>::compute_ker_dw(int ur_w, int pad_l,
                         }
                         compute(vmm_out(oi, ci), ymm_wei, ymm_src);
                     } else {
-                        assert(jcp.signed_input);
+                        assert(use_shift());
                         compute(vmm_out(oi, ci), ymm_wei, ymm_shifted_zero);
                     }
                 }
@@ -370,8 +388,8 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Vmm>::compute_ker(int ur_w, int pad_l,
         int ow_end = get_ow_end(ur_w, ki, pad_r);
         int ic_tail_size = jcp.ic_without_padding % 4;
 
-        int _start = jcp.signed_input ? 0 : ow_start;
-        int _end = jcp.signed_input ? ur_w : ow_end;
+        int _start = use_shift() ? 0 : ow_start;
+        int _end = use_shift() ? ur_w : ow_end;
 
         /* Skip the last loads of input if (ic % 8) / 4 < ic_block / 4 */
         int icb = (last_ic_block_flag != no_last_block)
@@ -409,7 +427,7 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Vmm>::compute_ker(int ur_w, int pad_l,
                                     vmm_inp(jj, nb_oc_block), vmm_shift);
                     } else {
                         /* fill padded area with shifted values */
-                        if (jcp.signed_input) {
+                        if (use_shift()) {
                             Vmm inp = vmm_inp(jj, nb_oc_block);
                             vmovups(inp, vmm_shift);
                         }
@@ -446,7 +464,7 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
     if (jcp.ndims == 5) {
         mov(aux_reg_ker_d, reg_ker);
         mov(aux_reg_inp_d, reg_inp);
-        if (jcp.signed_input) {
+        if (use_shift()) {
             //TODO: May be avoided when f_pad=0 and dd0
             //TODO: Potential optimization by precomputing, when kd <<< od?
             mov(reg_ki, ptr[param1 + GET_OFF(f_overflow)]);
@@ -471,8 +489,8 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         }
 
         mov(reg_ki, ptr[param1 + GET_OFF(kd_padding)]);
-        if ((jcp.signed_input) || (jcp.dilate_d >= jcp.id)
-                || (!jcp.signed_input
+        if (use_shift() || (jcp.dilate_d >= jcp.id)
+                || (!use_shift()
                         && (jcp.kd - 1) * (jcp.dilate_d + 1)
                                 < nstl::max(jcp.f_pad, jcp.back_pad))) {
             cmp(reg_ki, 0);
@@ -490,7 +508,7 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         mov(aux_reg_ker, reg_ker);
     }
 
-    if (jcp.signed_input && jcp.ndims > 3) {
+    if (use_shift() && jcp.ndims > 3) {
         mov(reg_overflow, ptr[param1 + GET_OFF(t_overflow)]);
         cmp(reg_overflow, 0);
         je(no_t_overflow_label, T_NEAR);
@@ -506,8 +524,8 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         L(no_t_overflow_label);
     }
     mov(reg_kj, ptr[param1 + GET_OFF(kh_padding)]);
-    if ((jcp.signed_input) || (jcp.dilate_h >= jcp.ih)
-            || (!jcp.signed_input
+    if (use_shift() || (jcp.dilate_h >= jcp.ih)
+            || (!use_shift()
                     && (jcp.kh - 1) * (jcp.dilate_h + 1)
                             < nstl::max(jcp.t_pad, jcp.b_pad))) {
         cmp(reg_kj, 0);
@@ -532,7 +550,7 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         jg(kh_label, T_NEAR);
     }
     L(skip_kh_loop);
-    if (jcp.signed_input && jcp.ndims > 3) {
+    if (use_shift() && jcp.ndims > 3) {
         mov(reg_overflow, ptr[param1 + GET_OFF(b_overflow)]);
         cmp(reg_overflow, 0);
         je(no_b_overflow_label, T_NEAR);
@@ -554,7 +572,7 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         jne(kd_label, T_NEAR);
 
         L(skip_kd_loop);
-        if (jcp.signed_input) {
+        if (use_shift()) {
             mov(reg_ki, ptr[param1 + GET_OFF(back_overflow)]);
             cmp(reg_ki, 0);
             je(no_back_overflow_label, T_NEAR);
@@ -660,7 +678,7 @@ void _jit_avx2_x8s8s32x_fwd_kernel<Vmm>::generate() {
         int idx = jcp.max_regs_ur - 1;
         if (!jcp.is_resrc_depthwise) ymm_src = Ymm(++idx);
         ymm_tmp = Ymm(++idx);
-        if (jcp.signed_input) {
+        if (use_shift()) {
             ymm_shifted_zero = Ymm(++idx);
             ++idx; // due to extra register used for shifts and compensations
         }
@@ -981,6 +999,10 @@ status_t jit_avx2_x8s8s32x_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
     if (kernel_outside_src) return status::unimplemented;
 
     jcp.signed_input = src_d.data_type() == data_type::s8;
+    if (!zero_point_utils::conv_zero_points_ok(attr, src_d.data_type()))
+        return status::unimplemented;
+    jcp.src_zero_point = !attr.zero_points_.has_default_values(DNNL_ARG_SRC);
+    jcp.dst_zero_point = !attr.zero_points_.has_default_values(DNNL_ARG_DST);
     jcp.is_depthwise = true && with_groups && everyone_is(1, jcp.ic, jcp.oc);
 
     if (is_3d && jcp.is_depthwise) return status::unimplemented;
@@ -1021,7 +1043,8 @@ status_t jit_avx2_x8s8s32x_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
     jcp.is_resrc_depthwise = true && jcp.is_depthwise && jcp.stride_w < jcp.kw
             && jcp.kw < 4 && jcp.dilate_w == 0;
     if (jcp.is_depthwise) {
-        jcp.max_regs_ur = 14 - !jcp.is_resrc_depthwise - 2 * jcp.signed_input;
+        const bool use_shift = jcp.signed_input || jcp.src_zero_point;
+        jcp.max_regs_ur = 14 - !jcp.is_resrc_depthwise - 2 * use_shift;
     } else {
         jcp.max_regs_ur = 12;
     }
@@ -1218,11 +1241,16 @@ void jit_avx2_x8s8s32x_fwd_kernel::init_scratchpad(
         const primitive_attr_t &attr) {
 
     if (jcp.signed_input) {
-        dim_t count = attr.output_scales_.count_ == 1
-                ? (dim_t)8
-                : attr.output_scales_.count_;
+        const dim_t count = jcp.is_oc_scale
+                ? nstl::max<dim_t>(jcp.ngroups * jcp.oc_without_padding, 8)
+                : 8;
         scratchpad.book<float>(key_conv_adjusted_scales, count);
     }
+    if (jcp.src_zero_point) {
+        const dim_t count = jcp.is_depthwise ? jcp.nb_ch * jcp.ch_block
+                                             : jcp.ngroups * jcp.oc;
+        scratchpad.book<int32_t>(key_conv_src_zp_compensation, count);
+    }
 }
 
 template struct _jit_avx2_x8s8s32x_fwd_kernel<Ymm>;
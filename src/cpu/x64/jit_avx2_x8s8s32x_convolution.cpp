@@ -19,6 +19,9 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/zero_point_utils.hpp"
+
 #include "cpu/x64/jit_avx2_x8s8s32x_convolution.hpp"
 
 namespace dnnl {
@@ -39,7 +42,7 @@ using jit_conv_ker_t = void (*)(jit_conv_call_s *);
                          : (d).blk_off(__VA_ARGS__))
 
 template <data_type_t src_type, data_type_t dst_type>
-void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
+status_t jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
         dst_type>::execute_forward_2d(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
@@ -61,11 +64,11 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
     assert(jcp.nb_ch % jcp.nb_ch_blocking == 0);
 
-    const float *oscales = pd()->attr()->output_scales_.scales_;
+    DEFINE_SCALES_BUFFER(oscales);
     if (jcp.signed_input) {
         auto local_scales = ctx.get_scratchpad_grantor().template get<float>(
                 key_conv_adjusted_scales);
-        size_t count = pd()->attr()->output_scales_.count_;
+        const size_t count = jcp.is_oc_scale ? pd()->OC() : 1;
         float factor = 1.f / pd()->jcp_.wei_adj_scale;
         if (count == 1) {
             utils::array_set(local_scales, oscales[0] * factor, 8);
@@ -76,10 +79,8 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
         oscales = local_scales;
     }
 
-    size_t offset = weights_d.size() - weights_d.additional_buffer_size();
-    auto w = const_cast<wei_data_t *>(weights);
-    int32_t *compensation
-            = (jcp.signed_input) ? reinterpret_cast<int32_t *>(&w[offset]) : 0;
+    int32_t *compensation = get_compensation(ctx, weights);
+    const bool use_shift = jcp.signed_input || jcp.src_zero_point;
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking_thr_chunk;
     int nb_groups = jcp.nb_ch;
     int work_amount = jcp.mb * nb_groups * oc_chunks * jcp.oh * jcp.nb_ow;
@@ -129,7 +130,7 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
                 auto bias_w = bias ? bias + (bias_d.blk_off(g_oc) * bia_dt_size)
                                    : 0;
                 int32_t *compensation_w
-                        = (jcp.signed_input) ? compensation + g_oc : 0;
+                        = use_shift ? compensation + g_oc : nullptr;
 
                 auto dst_w = dst + dst_d.blk_off(n, g_oc, oh_s, ow_s);
                 auto src_w = src + src_d.blk_off(n, g_ic, ih_s, iw_s);
@@ -150,9 +151,8 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
                     int kh_padding = nstl::max(
                             0, jcp.kh - i_t_overflow - i_b_overflow);
 
-                    size_t wei_stride = (!jcp.signed_input)
-                            ? i_t_overflow * wht_h_stride
-                            : 0;
+                    size_t wei_stride
+                            = (!use_shift) ? i_t_overflow * wht_h_stride : 0;
                     p.src = src_w + i_t_overflow * dilate_h * src_h_stride;
                     p.dst = dst_w;
                     p.filt = wht_w + wei_stride;
@@ -188,10 +188,11 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
             }
         }
     });
+    return status::success;
 }
 
 template <data_type_t src_type, data_type_t dst_type>
-void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
+status_t jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
         dst_type>::execute_forward_1d(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
@@ -211,11 +212,11 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
     assert(jcp.nb_ch % jcp.nb_ch_blocking == 0);
 
-    const float *oscales = pd()->attr()->output_scales_.scales_;
+    DEFINE_SCALES_BUFFER(oscales);
     if (jcp.signed_input) {
         auto local_scales = ctx.get_scratchpad_grantor().template get<float>(
                 key_conv_adjusted_scales);
-        size_t count = pd()->attr()->output_scales_.count_;
+        const size_t count = jcp.is_oc_scale ? pd()->OC() : 1;
         float factor = 1.f / pd()->jcp_.wei_adj_scale;
         if (count == 1) {
             utils::array_set(local_scales, oscales[0] * factor, 8);
@@ -225,10 +226,8 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
         }
         oscales = local_scales;
     }
-    size_t offset = weights_d.size() - weights_d.additional_buffer_size();
-    auto w = const_cast<wei_data_t *>(weights);
-    int32_t *compensation
-            = (jcp.signed_input) ? reinterpret_cast<int32_t *>(&w[offset]) : 0;
+    int32_t *compensation = get_compensation(ctx, weights);
+    const bool use_shift = jcp.signed_input || jcp.src_zero_point;
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
     int nb_groups = jcp.nb_ch / jcp.nb_ch_blocking;
     int group_block = jcp.ch_block;
@@ -269,7 +268,7 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
             int iw_s = ow_s * jcp.stride_w;
 
             p.bias = bias ? bias + (bias_d.blk_off(g_oc) * bia_dt_size) : 0;
-            p.compensation = (jcp.signed_input) ? compensation + g_oc : 0;
+            p.compensation = use_shift ? compensation + g_oc : nullptr;
             p.dst = dst + dst_d.blk_off(n, g_oc, ow_s);
             p.src = src + src_d.blk_off(n, g_ic, iw_s);
             p.filt = weights + wht_blk_off(weights_d, gb, ocb, 0);
@@ -304,10 +303,11 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
             }
         }
     });
+    return status::success;
 }
 
 template <data_type_t src_type, data_type_t dst_type>
-void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
+status_t jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
         dst_type>::execute_forward_2d_dw(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
@@ -331,11 +331,11 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
     assert(jcp.nb_oc_blocking == 1);
     assert(jcp.nb_ch % jcp.nb_ch_blocking == 0);
 
-    const float *oscales = pd()->attr()->output_scales_.scales_;
+    DEFINE_SCALES_BUFFER(oscales);
     if (jcp.signed_input) {
         auto local_scales = ctx.get_scratchpad_grantor().template get<float>(
                 key_conv_adjusted_scales);
-        size_t count = pd()->attr()->output_scales_.count_;
+        const size_t count = jcp.is_oc_scale ? pd()->OC() : 1;
         float factor = 1.f / pd()->jcp_.wei_adj_scale;
         if (count == 1) {
             utils::array_set(local_scales, oscales[0] * factor, 8);
@@ -346,10 +346,8 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
         oscales = local_scales;
     }
 
-    size_t offset = weights_d.size() - weights_d.additional_buffer_size();
-    auto w = const_cast<wei_data_t *>(weights);
-    int32_t *compensation
-            = (jcp.signed_input) ? reinterpret_cast<int32_t *>(&w[offset]) : 0;
+    int32_t *compensation = get_compensation(ctx, weights);
+    const bool use_shift = jcp.signed_input || jcp.src_zero_point;
     int nb_groups = jcp.nb_ch / jcp.nb_ch_blocking;
     int group_block = jcp.ch_block;
 
@@ -370,7 +368,7 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
                 auto bias_w
                         = bias ? bias + (bias_d.blk_off(g) * bia_dt_size) : 0;
                 int32_t *compensation_w
-                        = jcp.signed_input ? compensation + g : 0;
+                        = use_shift ? compensation + g : nullptr;
 
                 auto dst_w = dst + dst_d.blk_off(n, g, oh_s, ow_s);
                 auto src_w = src + src_d.blk_off(n, g, ih_s, iw_s);
@@ -390,7 +388,7 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
                         = nstl::max(0, jcp.kh - i_t_overflow - i_b_overflow);
 
                 size_t wei_stride
-                        = jcp.signed_input ? 0 : i_t_overflow * wht_h_stride;
+                        = use_shift ? 0 : i_t_overflow * wht_h_stride;
                 p.src = src_w + i_t_overflow * dilate_h * src_h_stride;
                 p.dst = dst_w;
                 p.filt = wht_w + wei_stride;
@@ -405,10 +403,11 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
 
                 kernel_->jit_ker(&p);
             });
+    return status::success;
 }
 
 template <data_type_t src_type, data_type_t dst_type>
-void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
+status_t jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
         dst_type>::execute_forward_3d(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
@@ -430,11 +429,11 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
     assert(jcp.nb_ch % jcp.nb_ch_blocking == 0);
 
-    const float *oscales = pd()->attr()->output_scales_.scales_;
+    DEFINE_SCALES_BUFFER(oscales);
     if (jcp.signed_input && jcp.ver != ver_vnni) {
         auto local_scales = ctx.get_scratchpad_grantor().template get<float>(
                 key_conv_adjusted_scales);
-        size_t count = pd()->attr()->output_scales_.count_;
+        const size_t count = jcp.is_oc_scale ? pd()->OC() : 1;
         float factor = 1.f / pd()->jcp_.wei_adj_scale;
         if (count == 1) {
             utils::array_set(local_scales, oscales[0] * factor, 8);
@@ -445,10 +444,8 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
         oscales = local_scales;
     }
 
-    size_t offset = weights_d.size() - weights_d.additional_buffer_size();
-    auto w = const_cast<wei_data_t *>(weights);
-    int32_t *compensation
-            = (jcp.signed_input) ? reinterpret_cast<int32_t *>(&w[offset]) : 0;
+    int32_t *compensation = get_compensation(ctx, weights);
+    const bool use_shift = jcp.signed_input || jcp.src_zero_point;
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking_thr_chunk;
     int nb_groups = jcp.nb_ch;
     int work_amount
@@ -510,13 +507,13 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
                 auto bias_w = bias ? bias + (bias_d.blk_off(g_oc) * bia_dt_size)
                                    : 0;
                 int32_t *compensation_w
-                        = (jcp.signed_input) ? compensation + g_oc : 0;
+                        = use_shift ? compensation + g_oc : nullptr;
 
                 auto dst_w = dst + dst_d.blk_off(n, g_oc, od_s, oh_s, ow_s);
                 auto src_w = src + src_d.blk_off(n, g_ic, id_s, ih_s, iw_s)
                         + d_f_overflow * dilate_d * src_d_stride;
                 auto wht_w = weights + wht_blk_off(weights_d, g, ocb, 0)
-                        + (jcp.signed_input ? 0 : d_f_overflow) * wht_d_stride;
+                        + (use_shift ? 0 : d_f_overflow) * wht_d_stride;
 
                 auto scales = &oscales[jcp.is_oc_scale * g_oc];
 
@@ -533,7 +530,7 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
                     int kh_padding = nstl::max(
                             0, jcp.kh - i_t_overflow - i_b_overflow);
 
-                    size_t wei_stride = (!jcp.signed_input) ? wht_h_stride : 0;
+                    size_t wei_stride = (!use_shift) ? wht_h_stride : 0;
                     p.src = src_w + i_t_overflow * dilate_h * src_h_stride;
                     p.dst = dst_w;
                     p.filt = wht_w + i_t_overflow * wei_stride;
@@ -574,6 +571,29 @@ void jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
             }
         }
     });
+    return status::success;
+}
+
+template <data_type_t src_type, data_type_t dst_type>
+int32_t *jit_avx2_x8s8s32x_convolution_fwd_t<src_type,
+        dst_type>::get_compensation(const exec_ctx_t &ctx,
+        const wei_data_t *weights) const {
+    const auto &jcp = pd()->jcp_;
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+
+    if (jcp.signed_input) {
+        size_t offset = weights_d.size() - weights_d.additional_buffer_size();
+        auto w = const_cast<wei_data_t *>(weights);
+        return reinterpret_cast<int32_t *>(&w[offset]);
+    }
+    if (!jcp.src_zero_point) return nullptr;
+
+    auto compensation = ctx.get_scratchpad_grantor().template get<int32_t>(
+            key_conv_src_zp_compensation);
+    zero_point_utils::compute_src_zp_compensation(weights_d, weights,
+            pd()->with_groups(), *pd()->attr()->zero_points_.get(DNNL_ARG_SRC),
+            compensation);
+    return compensation;
 }
 
 template struct jit_avx2_x8s8s32x_convolution_fwd_t<data_type::s8,
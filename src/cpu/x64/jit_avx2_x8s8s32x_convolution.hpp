@@ -52,7 +52,8 @@ struct jit_avx2_x8s8s32x_convolution_fwd_t : public primitive_t {
                                     data_type::s32, data_type::s8,
                                     data_type::u8))
                     && attr()->has_default_values(
-                            primitive_attr_t::skip_mask_t::oscale
+                            primitive_attr_t::skip_mask_t::oscale_runtime
+                            | primitive_attr_t::skip_mask_t::zero_points
                             | primitive_attr_t::skip_mask_t::post_ops)
                     && !has_zero_dim_memory();
             if (!args_ok) return status::unimplemented;
@@ -88,24 +89,25 @@ struct jit_avx2_x8s8s32x_convolution_fwd_t : public primitive_t {
         const bool is_dw = _pd->jcp_.is_depthwise;
 
         switch (ndims) {
-            case 3: execute_forward_1d(ctx); break;
+            case 3: return execute_forward_1d(ctx);
             case 4:
                 if (is_dw)
-                    execute_forward_2d_dw(ctx);
+                    return execute_forward_2d_dw(ctx);
                 else
-                    execute_forward_2d(ctx);
-                break;
-            case 5: execute_forward_3d(ctx); break;
+                    return execute_forward_2d(ctx);
+            case 5: return execute_forward_3d(ctx);
             default: return status::unimplemented;
         }
-        return status::success;
     }
 
 private:
-    void execute_forward_1d(const exec_ctx_t &ctx) const;
-    void execute_forward_2d(const exec_ctx_t &ctx) const;
-    void execute_forward_3d(const exec_ctx_t &ctx) const;
-    void execute_forward_2d_dw(const exec_ctx_t &ctx) const;
+    status_t execute_forward_1d(const exec_ctx_t &ctx) const;
+    status_t execute_forward_2d(const exec_ctx_t &ctx) const;
+    status_t execute_forward_3d(const exec_ctx_t &ctx) const;
+    status_t execute_forward_2d_dw(const exec_ctx_t &ctx) const;
+    // returns the compensation of the signed input or of the src zero point
+    int32_t *get_compensation(
+            const exec_ctx_t &ctx, const wei_data_t *weights) const;
     const pd_t *pd() const {
         return static_cast<const pd_t *>(primitive_t::pd().get());
     }
@@ -125,7 +125,8 @@ void jit_avx512_common_1x1_convolution_fwd_t<src_type, wei_type,
             scratchpad, memory_tracking::names::prefix_fusion);
     dst_data_t *pbuf;
     size_t row_offset;
-    const int jcp_dw_kh = 3;
+    const int jcp_dw_kh
+            = jcp.with_dw_conv ? pd()->dw_conv_pd_->jcp_.kh : 1;
     const int nb_buffer = jcp.nb_load_blocking;
     std::vector<dst_data_t *> addrs;
     // End
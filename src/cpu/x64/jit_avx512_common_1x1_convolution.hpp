@@ -208,8 +208,12 @@ struct jit_avx512_common_1x1_convolution_fwd_t : public primitive_t {
             jcp_dw.is_fused_conv = true;
             // TODO: Support/experiment arbitary oc_work in dw conv.
             // Until then we keep oc_work perfectly divisible.
-            while (jcp_1x1.nb_load % jcp_1x1.nb_load_blocking != 0)
-                --jcp_1x1.nb_load_blocking;
+            const size_t dw_row_block_size = (size_t)jcp_dw.kh * jcp_dw.iw
+                    * jcp_1x1.oc_block
+                    * types::data_type_size(dw_conv_pd_->src_md()->data_type);
+            jcp_1x1.nb_load_blocking = get_dw_conv_load_blocking(
+                    jcp_1x1.nb_load, jcp_1x1.nb_load_blocking,
+                    dw_row_block_size);
             jcp_1x1.nb_load_blocking_max = jcp_1x1.nb_load_blocking;
 
             while (jcp_1x1.nb_load_blocking % jcp_dw.nb_ch_blocking != 0)
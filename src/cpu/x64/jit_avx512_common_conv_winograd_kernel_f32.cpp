@@ -26,6 +26,7 @@
 #include "cpu/platform.hpp"
 
 #include "cpu/x64/jit_avx512_common_conv_winograd_kernel_f32.hpp"
+#include "cpu/x64/wino_conv_cost_model.hpp"
 
 #ifndef KERNEL_SIZE_THRESHOLD
 #define KERNEL_SIZE_THRESHOLD 16
@@ -66,15 +67,6 @@ int get_divisor_satisfying_cond(jit_conv_winograd_conf_t &jcp, int number,
     return best_divisor;
 }
 
-namespace {
-bool is_winograd_faster_than_direct(const jit_conv_winograd_conf_t &jcp) {
-    if (jcp.ver == ver_4fma)
-        return jcp.mb >= 32;
-    else
-        return jcp.mb >= 16;
-}
-} // namespace
-
 /* assumes 512 bits registers */
 /* TODO: add support for strides */
 /* TODO: handle the prefetch distance automatically */
@@ -379,8 +371,10 @@ status_t _jit_avx512_common_conv_winograd_data_kernel_f32::init_conf_common(
         jcp.ic = rnd_up(jcp.ic, simd_w);
     }
 
+    const cpu_isa_t isa = jcp.ver == ver_4fma ? avx512_mic_4ops : avx512_common;
     if (!IMPLICATION(cd.alg_kind == alg_kind::convolution_auto,
-                is_winograd_faster_than_direct(jcp)))
+                wino_conv_cost_model::is_winograd_faster_than_direct(
+                        cd, tile_size, isa, jcp.nthr)))
         return status::unimplemented;
 
     // Checking conditions not supported by these kernels
@@ -1061,8 +1055,10 @@ status_t jit_avx512_common_conv_winograd_bwd_weights_kernel_f32::init_conf(
     else
         jcp.ver = ver_fma;
 
+    const cpu_isa_t isa = jcp.ver == ver_4fma ? avx512_mic_4ops : avx512_common;
     if (!IMPLICATION(cd.alg_kind == alg_kind::convolution_auto,
-                is_winograd_faster_than_direct(jcp)))
+                wino_conv_cost_model::is_winograd_faster_than_direct(
+                        cd, tile_size, isa, jcp.nthr)))
         return status::unimplemented;
     // Winograd specific initialization
     jcp.itiles = (jcp.ow + tile_size - 1) / tile_size;
@@ -25,6 +25,7 @@
 
 #include "cpu/x64/jit_avx512_core_f32_wino_conv_2x3.hpp"
 #include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/wino_conv_cost_model.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -552,12 +553,6 @@ void jit_avx512_core_f32_wino_conv_2x3_fwd_ker_t::generate() {
     postamble();
 }
 
-namespace {
-bool is_winograd_faster_than_direct(const jit_conv_conf_2x3_wino_t &jcp) {
-    return jcp.mb >= 4;
-}
-} // namespace
-
 status_t jit_avx512_core_f32_wino_conv_2x3_fwd_ker_t ::init_conf(
         jit_conv_conf_2x3_wino_t &jcp, const convolution_desc_t &cd,
         memory_desc_t &src_md, memory_desc_t &wei_md, memory_desc_t &dst_md,
@@ -621,7 +616,8 @@ status_t jit_avx512_core_f32_wino_conv_2x3_fwd_ker_t ::init_conf(
     if (!(mayiuse(avx512_core))) return status::unimplemented;
 
     if (!IMPLICATION(cd.alg_kind == alg_kind::convolution_auto,
-                is_winograd_faster_than_direct(jcp)))
+                wino_conv_cost_model::is_winograd_faster_than_direct(
+                        cd, jcp.m, avx512_core, jcp.nthr)))
         return status::unimplemented;
 
     if (src_d.data_type() != data_type::f32) return status::unimplemented;
@@ -289,6 +289,18 @@ void _jit_avx512_core_f32_wino_conv_4x3_t<is_fwd>::_execute_data_W_S_G_D(
             jcp.dimK / jcp.dimK_reg_block, inph, inpw, jcp.dimK_reg_block);
     array_offset_calculator<float, 5> output(out_ptr, jcp.mb,
             jcp.dimM / jcp.dimM_simd_block, outh, outw, jcp.dimM_simd_block);
+    // the channel blocks are interleaved with the points in the nhwc case
+    const bool is_nhwc = is_fwd && jcp.src_tag == format_tag::nhwc;
+    auto input_blk = [&](int img, int blk) {
+        return is_nhwc ? inp_ptr + (size_t)img * inph * inpw * jcp.dimK
+                        + blk * jcp.dimK_reg_block
+                       : &(input(img, blk, 0, 0, 0));
+    };
+    auto output_blk = [&](int img, int blk) {
+        return is_nhwc ? out_ptr + (size_t)img * outh * outw * jcp.dimM
+                        + blk * jcp.dimM_simd_block
+                       : &(output(img, blk, 0, 0, 0));
+    };
     array_offset_calculator<float, 6> weights(wei_ptr,
             jcp.oc / jcp.oc_simd_block, jcp.ic / jcp.ic_simd_block, jcp.kh,
             jcp.kw, jcp.ic_simd_block, jcp.oc_simd_block);
@@ -326,8 +338,7 @@ void _jit_avx512_core_f32_wino_conv_4x3_t<is_fwd>::_execute_data_W_S_G_D(
     parallel_nd(jcp.mb, jcp.dimK_nb_block, jcp.dimK_block,
             [&](int img, int K_blk1, int K_blk2) {
                 input_transform_data(img, jcp,
-                        &(input(img, K_blk1 * jcp.dimK_block + K_blk2, 0, 0,
-                                0)),
+                        input_blk(img, K_blk1 * jcp.dimK_block + K_blk2),
                         &(V(0, 0, 0, 0, K_blk1, K_blk2, 0, 0)));
             });
 
@@ -373,7 +384,7 @@ void _jit_avx512_core_f32_wino_conv_4x3_t<is_fwd>::_execute_data_W_S_G_D(
                         : &bias(M_blk, 0);
                 output_transform_data(img, jcp, p_ops,
                         &(M(0, M_blk1, 0, 0, 0, M_blk2, 0, 0)),
-                        &(output(img, M_blk, 0, 0, 0)), bias_ptr);
+                        output_blk(img, M_blk), bias_ptr);
             });
 }
 
@@ -393,6 +404,18 @@ void _jit_avx512_core_f32_wino_conv_4x3_t<is_fwd>::_execute_data_W_SGD(
             jcp.dimK / jcp.dimK_reg_block, inph, inpw, jcp.dimK_reg_block);
     array_offset_calculator<float, 5> output(out_ptr, jcp.mb,
             jcp.dimM / jcp.dimM_simd_block, outh, outw, jcp.dimM_simd_block);
+    // the channel blocks are interleaved with the points in the nhwc case
+    const bool is_nhwc = is_fwd && jcp.src_tag == format_tag::nhwc;
+    auto input_blk = [&](int img, int blk) {
+        return is_nhwc ? inp_ptr + (size_t)img * inph * inpw * jcp.dimK
+                        + blk * jcp.dimK_reg_block
+                       : &(input(img, blk, 0, 0, 0));
+    };
+    auto output_blk = [&](int img, int blk) {
+        return is_nhwc ? out_ptr + (size_t)img * outh * outw * jcp.dimM
+                        + blk * jcp.dimM_simd_block
+                       : &(output(img, blk, 0, 0, 0));
+    };
     array_offset_calculator<float, 6> weights(wei_ptr,
             jcp.oc / jcp.oc_simd_block, jcp.ic / jcp.ic_simd_block, jcp.kh,
             jcp.kw, jcp.ic_simd_block, jcp.oc_simd_block);
@@ -454,8 +477,7 @@ void _jit_avx512_core_f32_wino_conv_4x3_t<is_fwd>::_execute_data_W_SGD(
                     for (int K_blk2 = 0; K_blk2 < jcp.dimK_block; K_blk2++) {
 
                         input_transform_tileblock_data(tile_block, jcp,
-                                &(input(0, K_blk1 * jcp.dimK_block + K_blk2, 0,
-                                        0, 0)),
+                                input_blk(0, K_blk1 * jcp.dimK_block + K_blk2),
                                 &(V(ithr, 0, 0, 0, K_blk1, K_blk2, 0, 0)));
                     }
                 }
@@ -495,7 +517,7 @@ void _jit_avx512_core_f32_wino_conv_4x3_t<is_fwd>::_execute_data_W_SGD(
 
                         output_transform_tileblock_data(tile_block, jcp, p_ops,
                                 &(M(ithr, M_blk1, 0, 0, 0, M_blk2, 0, 0)),
-                                &(output(0, M_blk, 0, 0, 0)), bias_ptr);
+                                output_blk(0, M_blk), bias_ptr);
                     }
                 }
             });
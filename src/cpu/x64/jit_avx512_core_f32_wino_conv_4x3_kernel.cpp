@@ -25,6 +25,7 @@
 #include "cpu/platform.hpp"
 
 #include "cpu/x64/jit_avx512_core_f32_wino_conv_4x3_kernel.hpp"
+#include "cpu/x64/wino_conv_cost_model.hpp"
 
 #define GET_OFF(field) offsetof(jit_wino_transform_call_s, field)
 
@@ -61,40 +62,6 @@ int get_divisor_satisfying_cond(jit_conv_winograd_conf_t &jcp, int number,
     return best_divisor;
 }
 
-namespace {
-bool is_winograd_faster_than_direct(const jit_conv_winograd_conf_t &jcp) {
-    /* Determines if current winograd implementation is faster than direct.
-       Following conditions are empirical and based on performance data */
-    unsigned int ncores_per_socket
-            = cpu.getNumCores(Xbyak::util::IntelCpuTopologyLevel::CoreLevel);
-    unsigned int nthreads = dnnl_get_max_threads();
-
-    if (jcp.prop_kind == prop_kind::forward_inference) {
-        return jcp.mb >= 4;
-    } else if (nthreads > ncores_per_socket) {
-        double src_dst_transforms_per_core = alpha * alpha * (jcp.ic + jcp.oc)
-                * jcp.mb * ((jcp.oh + tile_size - 1) / tile_size)
-                * ((jcp.ow + tile_size - 1) / tile_size) * sizeof(float) / 1024.
-                / 1024. / nthreads;
-        double wei_transform = alpha * alpha * jcp.ic * jcp.oc * sizeof(float)
-                / 1024. / 1024.;
-
-        if (jcp.prop_kind == prop_kind::backward_weights) {
-            if (src_dst_transforms_per_core < 0.3
-                    || (src_dst_transforms_per_core <= 28 && wei_transform < 4))
-                return false;
-            else
-                return true;
-        } else {
-            if (src_dst_transforms_per_core < 2.0 || wei_transform < 0.02)
-                return false;
-        }
-    }
-
-    return jcp.mb > 8;
-}
-} // namespace
-
 /* assumes 512 bits registers */
 /* TODO: add support for strides */
 /* TODO: handle the prefetch distance automatically */
@@ -666,6 +633,9 @@ void _jit_avx512_core_f32_wino_conv_4x3_data_kernel ::
     bool with_relu = jcp.with_eltwise;
     bool with_relu_postsum = jcp.with_relu_postsum;
     bool with_sum = jcp.with_sum;
+    // distance between the neighbouring points of a channel block
+    const int out_pix_stride
+            = (is_fwd && jcp.dst_tag == nhwc ? jcp.oc : simd_w) * typesize;
 
     auto zmm_zero = Xbyak::Zmm(0);
     auto zmm_temp = Xbyak::Zmm(31);
@@ -772,7 +742,7 @@ void _jit_avx512_core_f32_wino_conv_4x3_data_kernel ::
                 add(oreg_temp, i);
                 cmp(oreg_temp, outw);
                 jge(next, T_NEAR);
-                shl(oreg_temp, 4 + 2); // * 16 * 4
+                imul(oreg_temp, oreg_temp, out_pix_stride);
 
                 store_one(j, i, is_aligned);
 
@@ -788,7 +758,7 @@ void _jit_avx512_core_f32_wino_conv_4x3_data_kernel ::
             jge(next, T_NEAR);
 
             mov(oreg_out_j, oreg_dst);
-            imul(oreg_temp, oreg_temp, outw * simd_w * typesize);
+            imul(oreg_temp, oreg_temp, outw * out_pix_stride);
             add(oreg_out_j, oreg_temp);
 
             test(oreg_dst, 63);
@@ -891,6 +861,9 @@ void _jit_avx512_core_f32_wino_conv_4x3_data_kernel ::
     int hp_max = inph + t_pad;
     bool not_tiled = jcp.sched_policy == WSCHED_DATA_W_S_G_D;
     int G_size = 9;
+    // distance between the neighbouring points of a channel block
+    const int inp_pix_stride
+            = (is_fwd && jcp.src_tag == nhwc ? jcp.ic : simd_w) * typesize;
 
     auto zmm_zero = Xbyak::Zmm(0);
     auto zmm_temp = Xbyak::Zmm(31);
@@ -929,7 +902,7 @@ void _jit_avx512_core_f32_wino_conv_4x3_data_kernel ::
             cmovge(ireg_mask_j, ireg_zero);
 
             sub(ireg_temp, t_pad);
-            imul(ireg_temp, ireg_temp, inpw * simd_w * typesize);
+            imul(ireg_temp, ireg_temp, inpw * inp_pix_stride);
             mov(ireg_inp_j, ireg_src);
             add(ireg_inp_j, ireg_temp);
 
@@ -946,7 +919,7 @@ void _jit_avx512_core_f32_wino_conv_4x3_data_kernel ::
                 and_(ireg_mask, ireg_mask_j);
 
                 sub(ireg_temp, l_pad);
-                shl(ireg_temp, 4 + 2);
+                imul(ireg_temp, ireg_temp, inp_pix_stride);
 
                 vpxord(zmm_temp, zmm_temp, zmm_temp);
                 Opmask kmask = Opmask(7);
@@ -1153,7 +1126,8 @@ status_t _jit_avx512_core_f32_wino_conv_4x3_data_kernel::init_conf_common(
 
     // Checking conditions not supported by these kernels
     if (!IMPLICATION(cd.alg_kind == alg_kind::convolution_auto,
-                is_winograd_faster_than_direct(jcp)))
+                wino_conv_cost_model::is_winograd_faster_than_direct(
+                        cd, tile_size, avx512_core, jcp.nthr)))
         return status::unimplemented;
 
     if (jcp.ngroups != 1) return status::unimplemented;
@@ -1165,7 +1139,14 @@ status_t _jit_avx512_core_f32_wino_conv_4x3_data_kernel::init_conf_common(
     if ((jcp.ic % simd_w) != 0 || (jcp.oc % simd_w) != 0)
         return status::unimplemented;
 
-    format_tag_t dat_tag = nChw16c;
+    // The forward transforms access the channels last data directly. A
+    // channel block is loaded and stored as a whole, so that the channels
+    // are not padded in this case.
+    const bool is_fwd = one_of(
+            jcp.prop_kind, dnnl_forward_training, dnnl_forward_inference);
+    const bool nhwc_ok = is_fwd && jcp.ic == src_d.dims()[1]
+            && jcp.oc == jcp.oc_without_padding;
+    format_tag_t dat_tag = nhwc_ok && src_d.matches_tag(nhwc) ? nhwc : nChw16c;
     jcp.src_tag = src_d.matches_one_of_tag(dat_tag);
     jcp.dst_tag = dst_d.matches_one_of_tag(dat_tag);
 
@@ -2515,7 +2496,8 @@ status_t jit_avx512_core_f32_wino_conv_4x3_bwd_weights_kernel::init_conf(
 
     // Winograd kernel works only for 3x3 convolution with stride 1
     if (!IMPLICATION(cd.alg_kind == alg_kind::convolution_auto,
-                is_winograd_faster_than_direct(jcp)))
+                wino_conv_cost_model::is_winograd_faster_than_direct(
+                        cd, tile_size, avx512_core, jcp.nthr)))
         return status::unimplemented;
 
     if (jcp.ngroups != 1) return status::unimplemented;
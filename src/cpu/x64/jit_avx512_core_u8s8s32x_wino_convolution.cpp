@@ -26,6 +26,7 @@
 
 #include "cpu/x64/jit_avx512_core_u8s8s32x_wino_convolution.hpp"
 #include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/wino_conv_cost_model.hpp"
 
 #include <string.h>
 
@@ -687,18 +688,6 @@ void jit_avx512_core_u8s8s32x_wino_conv_fwd_ker_t::generate() {
 
     postamble();
 }
-namespace {
-bool is_winograd_faster_than_direct(const jit_conv_conf_2x3_wino_t &jcp) {
-    if (jcp.ver == ver_vnni) {
-        return (jcp.mb <= jcp.nthr
-                       && (jcp.mb > 4 && jcp.ic > 64
-                               && !(jcp.oc > 128 && jcp.ih < 14)))
-                || jcp.mb > jcp.nthr;
-    }
-    return true;
-}
-} // namespace
-
 status_t jit_avx512_core_u8s8s32x_wino_conv_fwd_ker_t::init_conf(
         jit_conv_conf_2x3_wino_t &jcp, const convolution_desc_t &cd,
         memory_desc_t &src_md, memory_desc_t &wei_md, memory_desc_t &dst_md,
@@ -742,10 +731,6 @@ status_t jit_avx512_core_u8s8s32x_wino_conv_fwd_ker_t::init_conf(
         return status::unimplemented;
     if (mayiuse(avx512_core_vnni)) jcp.ver = ver_vnni;
 
-    if (!IMPLICATION(cd.alg_kind == alg_kind::convolution_auto,
-                is_winograd_faster_than_direct(jcp)))
-        return status::unimplemented;
-
     // block sizes needed for GEMM kernel
     jcp.ic_block = 4;
     jcp.oc_block = 16;
@@ -783,6 +768,12 @@ status_t jit_avx512_core_u8s8s32x_wino_conv_fwd_ker_t::init_conf(
     jcp.r = 3;
     jcp.alpha = jcp.m + jcp.r - 1;
 
+    const cpu_isa_t isa = jcp.ver == ver_vnni ? avx512_core_vnni : avx512_core;
+    if (!IMPLICATION(cd.alg_kind == alg_kind::convolution_auto,
+                wino_conv_cost_model::is_winograd_faster_than_direct(
+                        cd, jcp.m, isa, jcp.nthr)))
+        return status::unimplemented;
+
     int aa = jcp.alpha * jcp.alpha;
     int L1_cap = platform::get_per_core_cache_size(1);
     int L2_cap = platform::get_per_core_cache_size(2);
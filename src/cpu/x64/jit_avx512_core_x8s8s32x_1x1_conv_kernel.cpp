@@ -24,6 +24,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/platform.hpp"
+#include "cpu/zero_point_utils.hpp"
 
 #include "cpu/x64/jit_avx512_core_x8s8s32x_1x1_conv_kernel.hpp"
 #include "cpu/x64/jit_uni_1x1_conv_utils.hpp"
@@ -212,14 +213,14 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::reduce_loop(
             auto vmm_bias = vmm_tmp;
             auto vmm_comp = vmm_bcast;
             if (jcp.with_bias) {
-                if (jcp.signed_input)
+                if (with_compensation())
                     mov(reg_bias_data,
                             EVEX_compress_addr(rsp, reg_bias_data_off));
                 cvt2ps(jcp.bia_dt, vmm_bias, bias_ptr(i_load), mask_flag);
                 if (jcp.signed_input && jcp.ver != ver_vnni)
                     vmulps(vmm_bias, vmm_bias, vmm_bias_alpha());
             }
-            if (jcp.signed_input) {
+            if (with_compensation()) {
                 mov(reg_comp_data, EVEX_compress_addr(rsp, reg_comp_data_off));
                 cvt2ps(data_type::s32, vmm_comp, comp_ptr(i_load), mask_flag);
             }
@@ -227,7 +228,7 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::reduce_loop(
             for (int i_ur = 0; i_ur < ur; ++i_ur) {
                 auto r = vreg_accum(i_load, i_ur);
                 vcvtdq2ps(r, r);
-                if (jcp.signed_input) vaddps(r, r, vmm_comp);
+                if (with_compensation()) vaddps(r, r, vmm_comp);
                 if (jcp.with_bias) vaddps(r, r, vmm_bias);
 
                 const Vmm mask_vmm = mask_flag ? r | ktail_mask | T_z : r;
@@ -259,6 +260,18 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::reduce_loop(
         if (maybe_eltwise(1))
             eltwise_injector_->compute_vector_range(0, ur * load_loop_blk);
 
+        if (jcp.dst_zero_point) {
+            const float dst_zp = (float)*attr_.zero_points_.get(DNNL_ARG_DST);
+            mov(reg_scratch, float2int(dst_zp));
+            vmovq(xmm_dst_zp, reg_scratch);
+            vbroadcastss(vmm_dst_zp, xmm_dst_zp);
+            for (int i_load = 0; i_load < load_loop_blk; ++i_load)
+                for (int i_ur = 0; i_ur < ur; ++i_ur) {
+                    auto r = vreg_accum(i_load, i_ur);
+                    vaddps(r, r, vmm_dst_zp);
+                }
+        }
+
         // Properly saturate the accumulators for integer datatypes
         if (one_of(jcp.dst_dt, u8, s8, s32)) {
             init_saturate_f32(vmm_zero, vmm_saturation,
@@ -416,7 +429,7 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::generate() {
     }
 
     if (jcp.with_bias) mov(reg_bias_data, ptr[param1 + GET_OFF(bias_data)]);
-    if (jcp.signed_input) {
+    if (with_compensation()) {
         mov(EVEX_compress_addr(rsp, reg_bias_data_off), reg_bias_data);
         mov(reg_comp_data, ptr[param1 + GET_OFF(compensation)]);
         mov(EVEX_compress_addr(rsp, reg_comp_data_off), reg_comp_data);
@@ -437,14 +450,14 @@ void _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Vmm>::generate() {
         bcast_loop(load_loop_blk);
         add(reg_load_data, load_loop_blk * jcp.load_loop_load_step);
         if (jcp.with_bias) {
-            if (jcp.signed_input)
+            if (with_compensation())
                 mov(reg_bias_data, EVEX_compress_addr(rsp, reg_bias_data_off));
             add(reg_bias_data,
                     load_loop_blk * jcp.load_block * jcp.typesize_bia);
-            if (jcp.signed_input)
+            if (with_compensation())
                 mov(EVEX_compress_addr(rsp, reg_bias_data_off), reg_bias_data);
         }
-        if (jcp.signed_input) {
+        if (with_compensation()) {
             mov(reg_comp_data, EVEX_compress_addr(rsp, reg_comp_data_off));
             add(reg_comp_data,
                     load_loop_blk * jcp.load_block * sizeof(int32_t));
@@ -624,6 +637,15 @@ status_t jit_avx512_core_x8s8s32x_1x1_conv_kernel::init_conf(
     jcp.with_eltwise = eltwise_ind != -1;
     if (jcp.with_eltwise) jcp.eltwise = p.entry_[eltwise_ind].eltwise;
 
+    if (!zero_point_utils::conv_zero_points_ok(attr, src_d.data_type()))
+        return status::unimplemented;
+    jcp.src_zero_point = !attr.zero_points_.has_default_values(DNNL_ARG_SRC);
+    jcp.dst_zero_point = !attr.zero_points_.has_default_values(DNNL_ARG_DST);
+    // the fused depthwise convolution would need the zero point of the
+    // intermediate result
+    if ((jcp.src_zero_point || jcp.dst_zero_point) && jcp.with_dw_conv)
+        return status::unimplemented;
+
     format_tag_t dat_tag = utils::pick(
             ndims - 3, format_tag::nwc, format_tag::nhwc, format_tag::ndhwc);
     jcp.src_tag = src_d.matches_one_of_tag(dat_tag);
@@ -892,10 +914,14 @@ void jit_avx512_core_x8s8s32x_1x1_conv_kernel::init_scratchpad(
     using namespace dnnl::impl::memory_tracking::names;
 
     if (jcp.signed_input && jcp.ver != ver_vnni) {
-        dim_t count = nstl::max<dim_t>(
-                attr.output_scales_.count_, (dim_t)jcp.ic_block);
+        const dim_t oc = jcp.is_oc_scale ? jcp.ngroups * jcp.oc_without_padding
+                                         : 1;
+        const dim_t count = nstl::max<dim_t>(oc, jcp.ic_block);
         scratchpad.book<float>(key_conv_adjusted_scales, count);
     }
+    if (jcp.src_zero_point)
+        scratchpad.book<int32_t>(
+                key_conv_src_zp_compensation, jcp.ngroups * jcp.oc);
 }
 
 template struct _jit_avx512_core_x8s8s32x_1x1_conv_kernel<Xbyak::Zmm>;
@@ -46,6 +46,10 @@ struct _jit_avx512_core_x8s8s32x_1x1_conv_kernel : public jit_generator {
     ~_jit_avx512_core_x8s8s32x_1x1_conv_kernel() { delete eltwise_injector_; }
 
     bool maybe_eltwise(int position);
+    // the s8 source and the src zero point are corrected by the compensation
+    bool with_compensation() const {
+        return jcp.signed_input || jcp.src_zero_point;
+    }
     jit_1x1_conv_conf_t jcp;
     const primitive_attr_t &attr_;
     void (*jit_ker)(jit_1x1_conv_call_s *);
@@ -84,6 +88,8 @@ private:
     const Vmm vmm_one = Vmm(29);
     const Vmm vmm_zero = Vmm(30);
     const Vmm vmm_prev_dst = Vmm(30);
+    const Vmm vmm_dst_zp = Vmm(30);
+    const Xbyak::Xmm xmm_dst_zp = Xbyak::Xmm(30);
     const Vmm vmm_shift = Vmm(30);
     const Vmm vmm_bcast = Vmm(31);
     const Vmm vmm_bias_alpha = Vmm(31);
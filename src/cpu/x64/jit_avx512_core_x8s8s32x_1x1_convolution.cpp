@@ -19,6 +19,9 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/zero_point_utils.hpp"
+
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/jit_avx512_core_x8s8s32x_1x1_convolution.hpp"
@@ -34,7 +37,7 @@ using namespace dnnl::impl::utils;
 
 /* convolution forward */
 template <data_type_t src_type, data_type_t dst_type>
-void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
+status_t jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
         dst_type>::execute_forward(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
@@ -47,18 +50,19 @@ void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
 
     auto scratchpad = ctx.get_scratchpad_grantor();
 
+    DEFINE_SCALES_BUFFER(oscales);
+
     if (pd()->jcp_.signed_input && pd()->jcp_.ver != ver_vnni) {
         auto local_scales
                 = scratchpad.template get<float>(key_conv_adjusted_scales);
-        auto scales = pd()->attr()->output_scales_.scales_;
-        size_t count = pd()->attr()->output_scales_.count_;
+        const size_t count = pd()->jcp_.is_oc_scale ? pd()->OC() : 1;
         float factor = 1.f / pd()->jcp_.wei_adj_scale;
         if (count == 1) {
             utils::array_set(
-                    local_scales, scales[0] * factor, pd()->jcp_.ic_block);
+                    local_scales, oscales[0] * factor, pd()->jcp_.ic_block);
         } else {
             for (size_t c = 0; c < count; c++)
-                local_scales[c] = scales[c] * factor;
+                local_scales[c] = oscales[c] * factor;
         }
     }
 
@@ -83,10 +87,20 @@ void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
             }
         }
     }
+    if (pd()->jcp_.src_zero_point) {
+        zero_point_utils::compute_src_zp_compensation(
+                memory_desc_wrapper(pd()->weights_md(0)), weights,
+                pd()->with_groups(),
+                *pd()->attr()->zero_points_.get(DNNL_ARG_SRC),
+                scratchpad.template get<int32_t>(
+                        key_conv_src_zp_compensation));
+    }
+
     parallel(pd()->jcp_.nthr, [&](const int ithr, const int nthr) {
         execute_forward_thr(ithr, nthr, src, weights, bias, weights_dw, bias_dw,
-                dst, scratchpad);
+                dst, oscales, scratchpad);
     });
+    return status::success;
 }
 
 template <data_type_t src_type, data_type_t dst_type>
@@ -94,6 +108,7 @@ void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
         dst_type>::execute_forward_thr(const int ithr, const int nthr,
         const src_data_t *src, const wei_data_t *weights, const char *bias,
         const wei_data_t *weights_dw, const char *bias_dw, dst_data_t *dst,
+        const float *oscales,
         const memory_tracking::grantor_t &scratchpad) const {
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
@@ -122,16 +137,13 @@ void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
     const int stride_h = pd()->KSH();
     const int stride_w = pd()->KSW();
 
-    float *oscales {nullptr};
-    if (jcp.signed_input && jcp.ver != ver_vnni)
-        oscales = scratchpad.get<float>(key_conv_adjusted_scales);
-    else
-        oscales = pd()->attr()->output_scales_.scales_;
-
     auto offset = weights_d.size() - weights_d.additional_buffer_size();
     wei_data_t *w = const_cast<wei_data_t *>(weights);
-    int32_t *compensation
-            = (jcp.signed_input) ? reinterpret_cast<int32_t *>(w + offset) : 0;
+    int32_t *compensation = jcp.signed_input
+            ? reinterpret_cast<int32_t *>(w + offset)
+            : jcp.src_zero_point
+                    ? scratchpad.get<int32_t>(key_conv_src_zp_compensation)
+                    : nullptr;
 
     auto p = jit_1x1_conv_call_s();
 
@@ -243,7 +255,7 @@ void jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t<src_type,
                                                : weights_d.blk_off(ocb, icb)];
         p.bias_data = &bias[_ocb * jcp.oc_block * bia_dt_size];
         p.compensation
-                = (jcp.signed_input) ? &compensation[_ocb * jcp.oc_block] : 0;
+                = compensation ? &compensation[_ocb * jcp.oc_block] : nullptr;
         p.scales = (jcp.signed_input && jcp.ver != ver_vnni)
                 ? &local_scales[jcp.is_oc_scale * _ocb * jcp.oc_block]
                 : &oscales[jcp.is_oc_scale * _ocb * jcp.oc_block];
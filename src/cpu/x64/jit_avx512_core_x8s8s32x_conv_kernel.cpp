@@ -21,6 +21,8 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/zero_point_utils.hpp"
+
 #include "cpu/x64/jit_avx512_core_x8s8s32x_conv_kernel.hpp"
 
 #define GET_OFF(field) offsetof(jit_conv_call_s, field)
@@ -71,8 +73,13 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::prepare_output(int ur_w) {
             Vmm vmm = vmm_out(j, k);
             vpxord(vmm, vmm, vmm);
         }
-    if (jcp.signed_input) {
-        mov(reg_scratch, 128);
+    if (use_shift()) {
+        // the padded taps are computed with the shifted zero for the signed
+        // input and with the src zero point otherwise
+        const int shift = jcp.signed_input
+                ? 128
+                : *attr_.zero_points_.get(DNNL_ARG_SRC);
+        mov(reg_scratch, shift);
         if (jcp.is_depthwise && !jcp.is_fast_depthwise)
             vpbroadcastd(vmm_shift, reg_scratch.cvt32());
         else
@@ -129,7 +136,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::store_output(
 
     mov(reg_bias, ptr[param1 + GET_OFF(bias)]);
     mov(reg_ptr_scales, ptr[param1 + GET_OFF(scales)]);
-    if (jcp.signed_input)
+    if (use_shift())
         mov(reg_compensation, ptr[param1 + GET_OFF(compensation)]);
 
     const auto &p = attr_.post_ops_;
@@ -161,7 +168,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::store_output(
             if (jcp.signed_input && jcp.ver != ver_vnni) /* bias *= 0.5 */
                 vmulps(vmm_bias, vmm_bias, vmm_bias_alpha());
         }
-        if (jcp.signed_input) {
+        if (use_shift()) {
             int comp_offset = sizeof(int32_t) * k * oc_block;
             auto comp_addr = EVEX_compress_addr(reg_compensation, comp_offset);
 
@@ -173,7 +180,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::store_output(
             if (jcp.is_fast_depthwise)
                 vpermd(zmm_out(j, k), zmm_permute, zmm_out(j, k));
             vcvtdq2ps(vmm, vmm);
-            if (jcp.signed_input) vaddps(vmm, vmm, vmm_comp);
+            if (use_shift()) vaddps(vmm, vmm, vmm_comp);
             if (jcp.with_bias) vaddps(vmm, vmm, vmm_bias);
 
             const Vmm vmm_k = vmm_mask(vmm, mask_flag);
@@ -203,6 +210,16 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::store_output(
     }
     if (maybe_eltwise(1)) compute_eltwise(ur_w);
 
+    if (jcp.dst_zero_point) {
+        const float dst_zp = (float)*attr_.zero_points_.get(DNNL_ARG_DST);
+        mov(aux_reg_saturation, float2int(dst_zp));
+        vmovq(Xmm(vmm_dst_zp.getIdx()), aux_reg_saturation);
+        vbroadcastss(vmm_dst_zp, Xmm(vmm_dst_zp.getIdx()));
+        for (int k = 0; k < nb_oc_block; k++)
+            for (int j = 0; j < ur_w; j++)
+                vaddps(vmm_out(j, k), vmm_out(j, k), vmm_dst_zp);
+    }
+
     // Properly saturate the accumulators for integer datatypes
     if (one_of(jcp.dst_dt, u8, s8, s32)) {
         init_saturate_f32(
@@ -295,7 +312,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Zmm>::compute_ker_dw(int ur_w,
         }
     }
 
-    if (jcp.signed_input) vmovups(zmm_shifted_zero, vmm_shift);
+    if (use_shift()) vmovups(zmm_shifted_zero, vmm_shift);
 
     for (int ci = 0; ci < jcp.nb_ch_blocking; ci++) {
         const bool mask_flag = last_ic_block_flag != no_last_block
@@ -331,7 +348,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Zmm>::compute_ker_dw(int ur_w,
                         EVEX_compress_addr(aux_reg_ker, aux_kernel_offset));
             }
             if (h_padded) {
-                assert(jcp.signed_input);
+                assert(use_shift());
                 for (int oi = 0; oi < ur_w; oi++)
                     compute(zmm_out(oi, ci), zmm_wei, zmm_shifted_zero);
             } else {
@@ -339,8 +356,8 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Zmm>::compute_ker_dw(int ur_w,
                         = mask_flag ? zmm_src | ktail_mask : zmm_src;
                 int oi_start = get_ow_start(ki, pad_l);
                 int oi_end = get_ow_end(ur_w, ki, pad_r);
-                int start_ = jcp.signed_input ? 0 : oi_start;
-                int end_ = jcp.signed_input ? ur_w : oi_end;
+                int start_ = use_shift() ? 0 : oi_start;
+                int end_ = use_shift() ? ur_w : oi_end;
                 for (int oi = start_; oi < end_; oi++) {
                     if (oi >= oi_start && oi < oi_end) {
                         if (jcp.is_resrc_depthwise) {
@@ -363,7 +380,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Zmm>::compute_ker_dw(int ur_w,
                         }
                         compute(zmm_out(oi, ci), zmm_wei, zmm_src);
                     } else {
-                        assert(jcp.signed_input);
+                        assert(use_shift());
                         compute(zmm_out(oi, ci), zmm_wei, zmm_shifted_zero);
                     }
                 }
@@ -412,8 +429,8 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::compute_ker(int ur_w, int pad_l,
         int jj_start = get_ow_start(ki, pad_l);
         int jj_end = get_ow_end(ur_w, ki, pad_r);
         int ic_tail_size = jcp.ic_without_padding % 4;
-        int _start = (jcp.signed_input) ? 0 : jj_start;
-        int _end = (jcp.signed_input) ? ur_w : jj_end;
+        int _start = use_shift() ? 0 : jj_start;
+        int _end = use_shift() ? ur_w : jj_end;
         /* Skip the last loads of input if (ic%16)/4 < ic_block/4 */
         int icb = (last_ic_block_flag != no_last_block)
                 ? div_up((jcp.ic_without_padding % ic_block), 4)
@@ -444,7 +461,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::compute_ker(int ur_w, int pad_l,
                                     vmm_inp(jj, nb_oc_block), vmm_shift);
                     } else {
                         /* fill padded area with shifted values */
-                        if (jcp.signed_input) {
+                        if (use_shift()) {
                             Vmm inp = vmm_inp(jj, nb_oc_block);
                             vmovups(inp, vmm_shift);
                         }
@@ -482,7 +499,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
     if (jcp.ndims == 5) {
         mov(aux_reg_ker_d, reg_ker);
         mov(aux_reg_inp_d, reg_inp);
-        if (jcp.signed_input) {
+        if (use_shift()) {
             //TODO: May be avoided when f_pad=0 and dd0
             //TODO: Potential optimization by precomputing, when kd <<< od?
             mov(reg_ki, ptr[param1 + GET_OFF(f_overflow)]);
@@ -507,8 +524,8 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         }
 
         mov(reg_ki, ptr[param1 + GET_OFF(kd_padding)]);
-        if ((jcp.signed_input) || (jcp.dilate_d >= jcp.id)
-                || (!jcp.signed_input
+        if (use_shift() || (jcp.dilate_d >= jcp.id)
+                || (!use_shift()
                         && (jcp.kd - 1) * (jcp.dilate_d + 1)
                                 < nstl::max(jcp.f_pad, jcp.back_pad))) {
             cmp(reg_ki, 0);
@@ -526,7 +543,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         mov(aux_reg_ker, reg_ker);
     }
 
-    if (jcp.signed_input && jcp.ndims > 3) {
+    if (use_shift() && jcp.ndims > 3) {
         mov(reg_overflow, ptr[param1 + GET_OFF(t_overflow)]);
         cmp(reg_overflow, 0);
         je(no_t_overflow_label, T_NEAR);
@@ -542,8 +559,8 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         L(no_t_overflow_label);
     }
     mov(reg_kj, ptr[param1 + GET_OFF(kh_padding)]);
-    if ((jcp.signed_input) || (jcp.dilate_h >= jcp.ih)
-            || (!jcp.signed_input
+    if (use_shift() || (jcp.dilate_h >= jcp.ih)
+            || (!use_shift()
                     && (jcp.kh - 1) * (jcp.dilate_h + 1)
                             < nstl::max(jcp.t_pad, jcp.b_pad))) {
         cmp(reg_kj, 0);
@@ -568,7 +585,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         jg(kh_label, T_NEAR);
     }
     L(skip_kh_loop);
-    if (jcp.signed_input && jcp.ndims > 3) {
+    if (use_shift() && jcp.ndims > 3) {
         mov(reg_overflow, ptr[param1 + GET_OFF(b_overflow)]);
         cmp(reg_overflow, 0);
         je(no_b_overflow_label, T_NEAR);
@@ -591,7 +608,7 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::kh_loop(
         jne(kd_label, T_NEAR);
 
         L(skip_kd_loop);
-        if (jcp.signed_input) {
+        if (use_shift()) {
             mov(reg_ki, ptr[param1 + GET_OFF(back_overflow)]);
             cmp(reg_ki, 0);
             je(no_back_overflow_label, T_NEAR);
@@ -698,10 +715,10 @@ void _jit_avx512_core_x8s8s32x_fwd_kernel<Vmm>::generate() {
         if (!jcp.is_resrc_depthwise) zmm_src = Zmm(++idx);
         if (jcp.ver != ver_vnni) zmm_tmp = Zmm(++idx);
         if (jcp.is_fast_depthwise) zmm_permute = Zmm(++idx);
-        if (jcp.signed_input) zmm_shifted_zero = Zmm(++idx);
+        if (use_shift()) zmm_shifted_zero = Zmm(++idx);
         // due to extra register used for shifts and compensations
         // and/or saturation, we increment by one more
-        if (jcp.signed_input || jcp.need_saturation) ++idx;
+        if (use_shift() || jcp.need_saturation) ++idx;
         assert(idx == ker_dw_reg_base_idx);
     }
 
@@ -1026,6 +1043,11 @@ status_t jit_avx512_core_x8s8s32x_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
     if (kernel_outside_src) return status::unimplemented;
 
     jcp.signed_input = (src_d.data_type() == data_type::s8) ? true : false;
+    if (!zero_point_utils::conv_zero_points_ok(attr, src_d.data_type()))
+        return status::unimplemented;
+    jcp.src_zero_point = !attr.zero_points_.has_default_values(DNNL_ARG_SRC);
+    jcp.dst_zero_point = !attr.zero_points_.has_default_values(DNNL_ARG_DST);
+    const bool use_shift = jcp.signed_input || jcp.src_zero_point;
     jcp.need_saturation = utils::one_of(dst_d.data_type(), u8, s8, s32);
     jcp.is_depthwise = true && with_groups && everyone_is(1, jcp.ic, jcp.oc);
 
@@ -1077,8 +1099,8 @@ status_t jit_avx512_core_x8s8s32x_fwd_kernel::init_conf(jit_conv_conf_t &jcp,
             && jcp.kw < 4 && jcp.dilate_w == 0;
     if (jcp.is_depthwise) {
         jcp.max_regs_ur = 31 - jcp.is_fast_depthwise - !jcp.is_resrc_depthwise
-                - jcp.signed_input - (jcp.ver != ver_vnni)
-                - (jcp.signed_input || jcp.need_saturation); // both alias
+                - use_shift - (jcp.ver != ver_vnni)
+                - (use_shift || jcp.need_saturation); // both alias
     } else {
         jcp.max_regs_ur = jcp.ver == ver_vnni ? 31 : 28;
     }
@@ -1300,11 +1322,17 @@ void jit_avx512_core_x8s8s32x_fwd_kernel::init_scratchpad(
         memory_tracking::registrar_t &scratchpad, const jit_conv_conf_t &jcp,
         const primitive_attr_t &attr) {
     if (jcp.signed_input && jcp.ver != ver_vnni) {
-        dim_t count = attr.output_scales_.count_ == 1
-                ? (dim_t)16
-                : attr.output_scales_.count_;
+        // the count of the attribute is unknown for the run-time scales
+        const dim_t count = jcp.is_oc_scale
+                ? nstl::max<dim_t>(jcp.ngroups * jcp.oc_without_padding, 16)
+                : 16;
         scratchpad.book<float>(key_conv_adjusted_scales, count);
     }
+    if (jcp.src_zero_point) {
+        const dim_t count = jcp.is_depthwise ? jcp.nb_ch * jcp.ch_block
+                                             : jcp.ngroups * jcp.oc;
+        scratchpad.book<int32_t>(key_conv_src_zp_compensation, count);
+    }
 }
 
 template struct _jit_avx512_core_x8s8s32x_fwd_kernel<Zmm>;
@@ -99,16 +99,18 @@ private:
 
     const Vmm vmm_wei = Vmm(31);
     /* used during bias section of store_output */
-    const Vmm vmm_comp = Vmm(30); // only for signed input
+    const Vmm vmm_comp = Vmm(30); // only for signed input and src zero point
     const Vmm vmm_bias = Vmm(31);
     /* used during post_op sum section of store_output */
     const Vmm vmm_prev_dst = Vmm(31);
+    /* used during dst zero point section of store_output */
+    const Vmm vmm_dst_zp = Vmm(31);
     /* used during write-out section of store_output */
     const Vmm vmm_saturation = Vmm(30);
     const Vmm vmm_zero = Vmm(31);
 
     /* used in compute_ker (but set during prepare_output) */
-    const Vmm vmm_shift = vmm_comp; // only for signed input
+    const Vmm vmm_shift = vmm_comp; // only if use_shift()
     /* used in compute_ker (but only for pre-VNNI machines) */
     const Vmm vmm_tmp = Vmm(28); // not used for depthwise
     const Vmm vmm_one
@@ -167,6 +169,10 @@ private:
                                 jcp.stride_w));
     }
 
+    // the padded area is computed explicitly with the shift value and the
+    // result is corrected by the compensation
+    bool use_shift() const { return jcp.signed_input || jcp.src_zero_point; }
+
     bool maybe_eltwise(int position);
     void prepare_output(int ur_w);
     void store_output(int ur_w, bool last_oc_block_flag);
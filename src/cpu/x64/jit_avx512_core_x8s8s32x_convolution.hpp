@@ -55,7 +55,8 @@ struct jit_avx512_core_x8s8s32x_convolution_fwd_t : public primitive_t {
                                     data_type::s32, data_type::s8,
                                     data_type::u8))
                     && attr()->has_default_values(
-                            primitive_attr_t::skip_mask_t::oscale
+                            primitive_attr_t::skip_mask_t::oscale_runtime
+                            | primitive_attr_t::skip_mask_t::zero_points
                             | primitive_attr_t::skip_mask_t::post_ops)
                     && !has_zero_dim_memory();
             if (!ok) return status::unimplemented;
@@ -90,24 +91,25 @@ struct jit_avx512_core_x8s8s32x_convolution_fwd_t : public primitive_t {
     status_t execute(const exec_ctx_t &ctx) const override {
         const auto &_pd = pd();
         if (_pd->ndims() == 3)
-            execute_forward_1d(ctx);
+            return execute_forward_1d(ctx);
         else if (_pd->ndims() == 4)
             if (_pd->jcp_.is_depthwise)
-                execute_forward_2d_dw(ctx);
+                return execute_forward_2d_dw(ctx);
             else
-                execute_forward_2d(ctx);
+                return execute_forward_2d(ctx);
         else if (_pd->ndims() == 5)
-            execute_forward_3d(ctx);
-        else
-            return status::unimplemented;
-        return status::success;
+            return execute_forward_3d(ctx);
+        return status::unimplemented;
     }
 
 private:
-    void execute_forward_1d(const exec_ctx_t &ctx) const;
-    void execute_forward_2d(const exec_ctx_t &ctx) const;
-    void execute_forward_2d_dw(const exec_ctx_t &ctx) const;
-    void execute_forward_3d(const exec_ctx_t &ctx) const;
+    status_t execute_forward_1d(const exec_ctx_t &ctx) const;
+    status_t execute_forward_2d(const exec_ctx_t &ctx) const;
+    status_t execute_forward_2d_dw(const exec_ctx_t &ctx) const;
+    status_t execute_forward_3d(const exec_ctx_t &ctx) const;
+    // returns the compensation of the signed input or of the src zero point
+    int32_t *get_compensation(
+            const exec_ctx_t &ctx, const wei_data_t *weights) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     jit_avx512_core_x8s8s32x_fwd_kernel *kernel_;
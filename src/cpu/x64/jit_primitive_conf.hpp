@@ -181,6 +181,9 @@ struct jit_conv_conf_t {
     bool signed_input;
     bool need_saturation;
     float wei_adj_scale;
+    // asymmetric quantization
+    bool src_zero_point;
+    bool dst_zero_point;
 
     bool uses_permw_transposition;
     bool transpose_src;
@@ -489,6 +492,9 @@ struct jit_1x1_conv_conf_t {
     data_type_t dst_dt;
     bool signed_input;
     float wei_adj_scale;
+    // asymmetric quantization
+    bool src_zero_point;
+    bool dst_zero_point;
 
     cpu_isa_t isa;
     bool uses_permw_transposition;
@@ -538,6 +544,7 @@ struct jit_pool_conf_t {
 
     int dt_size;
     bool is_bf16;
+    bool is_int8;
     jit_pool_tag_kind_t tag_kind;
     bool is_plain() const {
         return (tag_kind == jptg_ncsp || tag_kind == jptg_nspc);
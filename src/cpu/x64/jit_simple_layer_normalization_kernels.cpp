@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "common/type_helpers.hpp"
+
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/jit_simple_layer_normalization_kernels.hpp"
@@ -26,19 +28,167 @@ namespace lnorm_utils {
 
 using namespace dnnl::impl::cpu::lnorm_utils;
 
-struct jit_statistics_kernel_t : statistics_kernel_t, jit_generator {
+/* Loads and stores of a row of data converted from and to f32. Only the
+ * full vector (8 elements) and the scalar accesses are supported. */
+struct jit_lnorm_data_io_t : public jit_generator {
+protected:
+    void load_data(data_type_t dt, const Xbyak::Ymm &ymm,
+            const Xbyak::Reg64 &reg, int nelems, size_t offt) {
+        using namespace data_type;
+        Xbyak::Xmm xmm = Xbyak::Xmm(ymm.getIdx());
+        Xbyak::Reg32 reg_tmp = reg_io_tmp.cvt32();
+        if (nelems == 1) {
+            switch (dt) {
+                case f32: vmovss(xmm, dword[reg + offt]); break;
+                case bf16:
+                    movzx(reg_tmp, word[reg + offt]);
+                    shl(reg_tmp, 16);
+                    vmovd(xmm, reg_tmp);
+                    break;
+                case s8:
+                    movsx(reg_tmp, byte[reg + offt]);
+                    vmovd(xmm, reg_tmp);
+                    vcvtdq2ps(xmm, xmm);
+                    break;
+                case u8:
+                    movzx(reg_tmp, byte[reg + offt]);
+                    vmovd(xmm, reg_tmp);
+                    vcvtdq2ps(xmm, xmm);
+                    break;
+                default: assert(!"unsupported data type");
+            }
+        } else {
+            assert(nelems == 8);
+            switch (dt) {
+                case f32: vmovups(ymm, yword[reg + offt]); break;
+                case bf16:
+                    vpmovzxwd(ymm, xword[reg + offt]);
+                    vpslld(ymm, ymm, 16);
+                    break;
+                case s8:
+                    vpmovsxbd(ymm, qword[reg + offt]);
+                    vcvtdq2ps(ymm, ymm);
+                    break;
+                case u8:
+                    vpmovzxbd(ymm, qword[reg + offt]);
+                    vcvtdq2ps(ymm, ymm);
+                    break;
+                default: assert(!"unsupported data type");
+            }
+        }
+    }
+
+    void broadcast_const(const Xbyak::Ymm &ymm, uint32_t value) {
+        mov(reg_io_tmp.cvt32(), value);
+        vmovd(Xbyak::Xmm(ymm.getIdx()), reg_io_tmp.cvt32());
+        vpbroadcastd(ymm, Xbyak::Xmm(ymm.getIdx()));
+    }
+
+    // must be called once before the stores
+    void init_store(data_type_t dt) {
+        using namespace data_type;
+        switch (dt) {
+            case bf16:
+                broadcast_const(ymm_cvt_c0, 0x1);
+                broadcast_const(ymm_cvt_c1, 0x7fff);
+                broadcast_const(ymm_cvt_c2, 0x7fc00000); // quiet NaN
+                break;
+            case s8:
+                broadcast_const(ymm_cvt_c0, float2int(-128.f));
+                broadcast_const(ymm_cvt_c1, float2int(127.f));
+                break;
+            case u8:
+                broadcast_const(ymm_cvt_c0, float2int(0.f));
+                broadcast_const(ymm_cvt_c1, float2int(255.f));
+                break;
+            default: break;
+        }
+    }
+
+    // the stored register is used as a temporary one
+    void store_data(data_type_t dt, const Xbyak::Ymm &ymm,
+            const Xbyak::Reg64 &reg, int nelems, size_t offt) {
+        using namespace data_type;
+        using namespace Xbyak;
+        assert(utils::one_of(nelems, 1, 8));
+        const bool scalar = nelems == 1;
+        Xmm xmm = Xmm(ymm.getIdx());
+        Xmm xmm_cvt = Xmm(ymm_cvt.getIdx());
+        Xmm xmm_cvt_aux = Xmm(ymm_cvt_aux.getIdx());
+        switch (dt) {
+            case f32:
+                if (scalar)
+                    vmovss(dword[reg + offt], xmm);
+                else
+                    vmovups(yword[reg + offt], ymm);
+                break;
+            case bf16:
+                // round to nearest even: (x + 0x7fff + ((x >> 16) & 1)) >> 16
+                vpsrld(ymm_cvt, ymm, 16);
+                vpand(ymm_cvt, ymm_cvt, ymm_cvt_c0);
+                vpaddd(ymm_cvt, ymm_cvt, ymm_cvt_c1);
+                vpaddd(ymm_cvt, ymm_cvt, ymm);
+                vcmpunordps(ymm_cvt_aux, ymm, ymm);
+                vblendvps(ymm_cvt, ymm_cvt, ymm_cvt_c2, ymm_cvt_aux);
+                vpsrld(ymm_cvt, ymm_cvt, 16);
+                if (scalar) {
+                    vmovd(reg_io_tmp.cvt32(), xmm_cvt);
+                    mov(word[reg + offt], reg_io_tmp.cvt16());
+                } else {
+                    vextracti128(xmm_cvt_aux, ymm_cvt, 1);
+                    vpackusdw(xmm_cvt, xmm_cvt, xmm_cvt_aux);
+                    vmovdqu(xword[reg + offt], xmm_cvt);
+                }
+                break;
+            case s8:
+            case u8:
+                // saturation in f32 makes the integer packing below exact
+                vmaxps(ymm, ymm, ymm_cvt_c0);
+                vminps(ymm, ymm, ymm_cvt_c1);
+                vcvtps2dq(ymm, ymm);
+                if (scalar) {
+                    vmovd(reg_io_tmp.cvt32(), xmm);
+                    mov(byte[reg + offt], reg_io_tmp.cvt8());
+                } else {
+                    vextracti128(xmm_cvt, ymm, 1);
+                    vpackssdw(xmm, xmm, xmm_cvt);
+                    if (dt == s8)
+                        vpacksswb(xmm, xmm, xmm);
+                    else
+                        vpackuswb(xmm, xmm, xmm);
+                    vmovq(qword[reg + offt], xmm);
+                }
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    Xbyak::Reg64 reg_io_tmp = r11;
+
+    // used by the stores only
+    Xbyak::Ymm ymm_cvt = Xbyak::Ymm(2);
+    Xbyak::Ymm ymm_cvt_aux = Xbyak::Ymm(3);
+    Xbyak::Ymm ymm_cvt_c0 = Xbyak::Ymm(4);
+    Xbyak::Ymm ymm_cvt_c1 = Xbyak::Ymm(5);
+    Xbyak::Ymm ymm_cvt_c2 = Xbyak::Ymm(6);
+};
+
+struct jit_statistics_kernel_t : statistics_kernel_t, jit_lnorm_data_io_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(lnorm_utils::jit_statistics_kernel_t);
 
-    jit_statistics_kernel_t(const layer_normalization_pd_t *pd)
-        : statistics_kernel_t(pd) {
+    jit_statistics_kernel_t(const layer_normalization_pd_t *pd, int C)
+        : statistics_kernel_t(pd, C)
+        , data_size_(types::data_type_size(data_type_)) {
         assert(mayiuse(avx2));
         generate();
     }
 
-    void operator()(const float *src, float *mean, float *var) const override {
+    void operator()(const void *src, const void *src_add, float *mean,
+            float *var) const override {
         assert(ker_);
         ker_args_t args;
         args.src = src;
+        args.src_add = src_add;
         args.mean = mean;
         args.var = var;
         ker_(&args);
@@ -47,9 +197,11 @@ struct jit_statistics_kernel_t : statistics_kernel_t, jit_generator {
 private:
     int unroll_factor_ = 8;
     int simd_w_ = 8;
+    size_t data_size_;
 
     struct ker_args_t {
-        const float *src;
+        const void *src;
+        const void *src_add;
         float *mean;
         float *var;
     };
@@ -61,13 +213,16 @@ private:
         preamble();
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
         mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        if (with_add_) mov(reg_src_add, ptr[reg_param + PARAM_OFF(src_add)]);
         mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
         mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
 #undef PARAM_OFF
 
         // compute mean
         compute([=](Ymm ymm_dst) { vaddps(ymm_dst, ymm_dst, ymm_src); });
-        movss(ptr[reg_mean], Xmm(0));
+        if (return_sums_) movss(ptr[reg_mean], Xmm(0));
+        scale();
+        if (!return_sums_) movss(ptr[reg_mean], Xmm(0));
 
         //compute var
         vbroadcastss(ymm_mean, Xmm(0));
@@ -75,6 +230,7 @@ private:
             vsubps(ymm_src, ymm_mean, ymm_src);
             vfmadd231ps(ymm_dst, ymm_src, ymm_src);
         });
+        if (!return_sums_) scale();
         movss(ptr[reg_var], Xmm(0));
 
         postamble();
@@ -82,13 +238,14 @@ private:
         ker_ = getCode<decltype(ker_)>();
     }
 
-    void load_src(Xbyak::Ymm &ymm_src, int nelems, size_t offt = 0) {
-        if (nelems == 1)
-            movss(Xbyak::Xmm(ymm_src.getIdx()), dword[reg_src + offt]);
-        else if (nelems == simd_w_)
-            vmovups(ymm_src, yword[reg_src + offt]);
-        else
-            assert(!"unsupported nelems for load src");
+    // loads the sum of the sources starting from the element idx
+    void load_src(Xbyak::Ymm &ymm_src, int nelems, size_t idx = 0) {
+        load_data(data_type_, ymm_src, reg_src, nelems, idx * data_size_);
+        if (with_add_) {
+            load_data(data_type_, ymm_src_add, reg_src_add, nelems,
+                    idx * data_size_);
+            vaddps(ymm_src, ymm_src, ymm_src_add);
+        }
     }
 
     template <typename F>
@@ -108,8 +265,7 @@ private:
             // unrolled loop
             for (int i = 0; i < C_vecs / unroll; i++)
                 for (int j = 0; j < unroll; j++) {
-                    load_src(ymm_src, simd_w_,
-                            (i * unroll + j) * simd_w_ * sizeof(float));
+                    load_src(ymm_src, simd_w_, (i * unroll + j) * simd_w_);
                     op(Ymm(j));
                 }
 
@@ -123,7 +279,7 @@ private:
 
             // unrolled loop remainder
             for (int i = utils::rnd_dn(C_vecs, unroll); i < C_vecs; i++) {
-                load_src(ymm_src, simd_w_, i * simd_w_ * sizeof(float));
+                load_src(ymm_src, simd_w_, i * simd_w_);
                 op(Ymm(0));
             }
 
@@ -137,41 +293,50 @@ private:
 
         // vector remainder
         for (int i = utils::rnd_dn(C_, simd_w_); i < C_; i++) {
-            load_src(ymm_src, 1, i * sizeof(float));
+            load_src(ymm_src, 1, i);
             op(Ymm(0));
         }
+    };
 
-        // scale
+    // divides the reduced value by the number of elements
+    void scale() {
+        using namespace Xbyak;
         Xmm xmm_tmp = Xmm(ymm_src.getIdx());
         mov(reg_tmp, float2int(C_));
         uni_vmovq(xmm_tmp, reg_tmp);
         divss(Xmm(0), xmm_tmp);
-    };
+    }
 
     Xbyak::Reg64 reg_param = abi_param1;
     Xbyak::Reg64 reg_src = rdx;
+    Xbyak::Reg64 reg_src_add = r8;
     Xbyak::Reg64 reg_mean = rbx;
     Xbyak::Reg64 reg_var = rbp;
     Xbyak::Reg64 reg_tmp = rax;
 
     // vector registers 0 .. unroll_factor_ are reseved for unrolling
+    Xbyak::Ymm ymm_src_add = Xbyak::Ymm(13);
     Xbyak::Ymm ymm_src = Xbyak::Ymm(14);
     Xbyak::Ymm ymm_mean = Xbyak::Ymm(15);
 };
 
-struct jit_data_kernel_t : data_kernel_t, jit_generator {
+struct jit_data_kernel_t : data_kernel_t, jit_lnorm_data_io_t {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(lnorm_utils::jit_data_kernel_t);
 
-    jit_data_kernel_t(const layer_normalization_pd_t *pd) : data_kernel_t(pd) {
+    jit_data_kernel_t(const layer_normalization_pd_t *pd, int C)
+        : data_kernel_t(pd, C)
+        , data_size_(types::data_type_size(data_type_)) {
         assert(mayiuse(avx2));
         generate();
     }
 
-    void operator()(const float *src, float *dst, const float *ss,
-            const float *mean, const float *var) const override {
+    void operator()(const void *src, const void *src_add, void *dst,
+            const float *ss, const float *mean,
+            const float *var) const override {
         assert(ker_);
         ker_args_t args;
         args.src = src;
+        args.src_add = src_add;
         args.dst = dst;
         args.ss = ss;
         args.mean = mean;
@@ -182,10 +347,12 @@ struct jit_data_kernel_t : data_kernel_t, jit_generator {
 
 private:
     int simd_w_ = 8;
+    size_t data_size_;
 
     struct ker_args_t {
-        const float *src;
-        float *dst;
+        const void *src;
+        const void *src_add;
+        void *dst;
         const float *ss;
         const float *mean;
         const float *inv_sqrtvar;
@@ -202,22 +369,13 @@ private:
             assert(!"unsupported nelems");
     }
 
-    void store(Xbyak::Ymm &ymm_dst, Xbyak::Reg64 reg_dst, int nelems,
-            size_t offt) {
-        if (nelems == 1)
-            movss(dword[reg_dst + offt], Xbyak::Xmm(ymm_dst.getIdx()));
-        else if (nelems == simd_w_)
-            vmovups(yword[reg_dst + offt], ymm_dst);
-        else
-            assert(!"unsupported nelems");
-    }
-
     void generate() {
         using namespace Xbyak;
 
         preamble();
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
         mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        if (with_add_) mov(reg_src_add, ptr[reg_param + PARAM_OFF(src_add)]);
         mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
         mov(reg_ss, ptr[reg_param + PARAM_OFF(ss)]);
 
@@ -231,25 +389,40 @@ private:
         vbroadcastss(ymm_inv_sqrtvar, xmm_tmp);
 #undef PARAM_OFF
 
+        const bool with_output_scale = output_scale_ != 1.f;
+        if (with_output_scale)
+            broadcast_const(ymm_output_scale, float2int(output_scale_));
+        init_store(data_type_);
+
         const int C_vecs = C_ / simd_w_;
 
-        auto op = [=](int nelems, size_t offt) {
+        auto op = [=](int nelems, size_t idx) {
+            const size_t ss_offt = idx * sizeof(float);
+            const size_t data_offt = idx * data_size_;
             if (use_scaleshift_) {
-                load(ymm_gamma, reg_ss, nelems, offt);
-                load(ymm_beta, reg_ss, nelems, offt + C_ * sizeof(float));
+                load(ymm_gamma, reg_ss, nelems, ss_offt);
+                load(ymm_beta, reg_ss, nelems,
+                        ss_offt + shift_off_ * sizeof(float));
+            }
+            load_data(data_type_, ymm_data, reg_src, nelems, data_offt);
+            if (with_add_) {
+                load_data(data_type_, ymm_src_add, reg_src_add, nelems,
+                        data_offt);
+                vaddps(ymm_data, ymm_data, ymm_src_add);
             }
-            load(ymm_data, reg_src, nelems, offt);
             vsubps(ymm_data, ymm_data, ymm_mean);
             vmulps(ymm_data, ymm_data, ymm_inv_sqrtvar);
             if (use_scaleshift_) vfmadd213ps(ymm_data, ymm_gamma, ymm_beta);
-            store(ymm_data, reg_dst, nelems, offt);
+            if (with_output_scale)
+                vmulps(ymm_data, ymm_data, ymm_output_scale);
+            store_data(data_type_, ymm_data, reg_dst, nelems, data_offt);
         };
 
         for (int i = 0; i < C_vecs; i++)
-            op(simd_w_, i * simd_w_ * sizeof(float));
+            op(simd_w_, i * simd_w_);
 
         for (int i = utils::rnd_dn(C_, simd_w_); i < C_; i++)
-            op(1, i * sizeof(float));
+            op(1, i);
 
         postamble();
 
@@ -258,10 +431,14 @@ private:
 
     Xbyak::Reg64 reg_param = abi_param1;
     Xbyak::Reg64 reg_src = rdx;
+    Xbyak::Reg64 reg_src_add = r10;
     Xbyak::Reg64 reg_dst = rax;
     Xbyak::Reg64 reg_ss = r9;
     Xbyak::Reg64 reg_tmp = r8;
 
+    // vector registers 2 .. 6 are reserved for the data conversion
+    Xbyak::Ymm ymm_output_scale = Xbyak::Ymm(8);
+    Xbyak::Ymm ymm_src_add = Xbyak::Ymm(9);
     Xbyak::Ymm ymm_inv_sqrtvar = Xbyak::Ymm(10);
     Xbyak::Ymm ymm_data = Xbyak::Ymm(11);
     Xbyak::Ymm ymm_gamma = Xbyak::Ymm(12);
@@ -564,12 +741,13 @@ private:
 };
 
 statistics_kernel_t *jit_statistics_kernel_create(
-        const layer_normalization_pd_t *pd) {
-    return mayiuse(avx2) ? new jit_statistics_kernel_t(pd) : nullptr;
+        const layer_normalization_pd_t *pd, int C) {
+    return mayiuse(avx2) ? new jit_statistics_kernel_t(pd, C) : nullptr;
 }
 
-data_kernel_t *jit_data_kernel_create(const layer_normalization_pd_t *pd) {
-    return mayiuse(avx2) ? new jit_data_kernel_t(pd) : nullptr;
+data_kernel_t *jit_data_kernel_create(
+        const layer_normalization_pd_t *pd, int C) {
+    return mayiuse(avx2) ? new jit_data_kernel_t(pd, C) : nullptr;
 }
 
 diff_ss_kernel_t *jit_diff_ss_kernel_create(
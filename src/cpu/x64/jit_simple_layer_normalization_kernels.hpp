@@ -26,10 +26,10 @@ namespace x64 {
 namespace lnorm_utils {
 
 cpu::lnorm_utils::statistics_kernel_t *jit_statistics_kernel_create(
-        const layer_normalization_pd_t *pd);
+        const layer_normalization_pd_t *pd, int C);
 
 cpu::lnorm_utils::data_kernel_t *jit_data_kernel_create(
-        const layer_normalization_pd_t *pd);
+        const layer_normalization_pd_t *pd, int C);
 
 cpu::lnorm_utils::diff_ss_kernel_t *jit_diff_ss_kernel_create(
         const layer_normalization_pd_t *pd);
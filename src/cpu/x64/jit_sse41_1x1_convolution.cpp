@@ -94,7 +94,8 @@ void jit_sse41_1x1_convolution_fwd_t::execute_forward_thr(const int ithr,
     data_t *pbuf {nullptr};
     size_t row_offset {};
     const int nb_buffer = jcp.nb_load_blocking;
-    const int jcp_dw_kh = 3;
+    const int jcp_dw_kh
+            = jcp.with_dw_conv ? pd()->dw_conv_pd_->jcp_.kh : 1;
     std::vector<data_t *> addrs;
 
     auto step = [](int default_step, int remaining, int tail_step) {
@@ -61,6 +61,7 @@ struct jit_bnorm_t : public jit_generator {
         const acc_data_t *diff_scale_shift;
         const void *src, *dst;
         const void *diff_src, *diff_dst;
+        const void *src_add, *diff_src_add;
         const acc_data_t *rbuf1, *rbuf2;
         const uint8_t *ws;
         barrier::ctx_64_t *barrier;
@@ -126,6 +127,11 @@ struct jit_bnorm_t : public jit_generator {
     Label l_relu_mask_avx2;
     Opmask kstore_mask = Opmask(1);
 
+    // Fused add section
+    bool with_add;
+    Reg64 reg_src_add = reg_rbuf1; // fwd: free once the stats are computed
+    Reg64 reg_diff_src_add = reg_rbuf2; // bwd: free in the diff_src pass
+
     // channel tail processing
     Opmask ktail_mask = Opmask(2);
 
@@ -174,7 +180,9 @@ struct jit_bnorm_t : public jit_generator {
         stack_off_s_tail = 88,
         stack_off_is_cblk_tail = 96,
         stack_off_ws_off_copy = 104,
-        stack_size_required = 112,
+        stack_off_src_add = 112,
+        stack_off_diff_src_add = 120,
+        stack_size_required = 128,
     };
 
     int bit_shift() { return 5 - is_bf16_; }
@@ -233,6 +241,12 @@ struct jit_bnorm_t : public jit_generator {
         mov(ptr[rsp + stack_off_diff_dst], reg_tmp);
         mov(reg_tmp, ptr[reg_param + PARAM_OFF(ws)]);
         mov(ptr[rsp + stack_off_ws], reg_tmp);
+        if (with_add) {
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(src_add)]);
+            mov(ptr[rsp + stack_off_src_add], reg_tmp);
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(diff_src_add)]);
+            mov(ptr[rsp + stack_off_diff_src_add], reg_tmp);
+        }
         mov(reg_tmp, ptr[reg_param + PARAM_OFF(barrier)]);
         mov(ptr[rsp + stack_off_barrier], reg_tmp);
         if (is_spatial_thr_) {
@@ -284,11 +298,13 @@ struct jit_bnorm_t : public jit_generator {
     }
 
     void prepare_relu() {
+        const bool fuse_relu
+                = bdesc_->fuse_norm_relu() || bdesc_->fuse_norm_add_relu();
         with_relu = bdesc_->is_fwd()
-                ? bdesc_->with_relu_post_op() || bdesc_->fuse_norm_relu()
-                : bdesc_->fuse_norm_relu();
+                ? bdesc_->with_relu_post_op() || fuse_relu
+                : fuse_relu;
         with_relu_inf_only = with_relu && bdesc_->is_fwd()
-                && !(bdesc_->fuse_norm_relu() && bdesc_->is_training());
+                && !(fuse_relu && bdesc_->is_training());
 
         vzero = bdesc_->is_fwd() ? vdiff_beta : vbeta;
         if (with_relu) {
@@ -347,6 +363,17 @@ struct jit_bnorm_t : public jit_generator {
         shl(is_nspc_ ? reg_soff_nspc : reg_soff, bit_shift());
     }
 
+    // diff_src_1 is the diff_dst masked by ReLU; vtmp is used to keep vdiff
+    // intact, since the down conversion to bf16 overwrites the register
+    void store_diff_src_add(const Address &addr, Vmm vdiff, Vmm vtmp) {
+        if (is_bf16_) {
+            uni_vmovups(vtmp, vdiff);
+            uni_vmovups_spat_data(addr, vtmp);
+        } else {
+            uni_vmovups(addr, vdiff);
+        }
+    }
+
     void uni_vmovups_spat_data(const Operand &dst, const Operand &src) {
         if (dst.isMEM()) {
             if (is_bf16_) {
@@ -648,6 +675,12 @@ struct jit_bnorm_t : public jit_generator {
                         uni_vmulps(Vmm(idx), Vmm(idx), vsqrtvar);
                     }
 
+                    if (with_add) { // --flags=D
+                        uni_vmovups_spat_data(vbuf,
+                                vmmword[reg_src_add + reg_soff_nspc + offt]);
+                        uni_vaddps(Vmm(idx), Vmm(idx), vbuf);
+                    }
+
                     if (with_relu_inf_only) { // --attr=post_ops='relu'
                         uni_vmaxps(Vmm(idx), Vmm(idx), vzero);
                     } else if (with_relu) { // --flags=R
@@ -969,6 +1002,11 @@ struct jit_bnorm_t : public jit_generator {
                             } else {
                                 uni_vmulps(v, v, vsqrtvar);
                             }
+                            if (with_add) {
+                                uni_vmovups_spat_data(vbuf,
+                                        vmmword[reg_src_add + reg_soff + offt]);
+                                uni_vaddps(v, v, vbuf);
+                            }
                             if (with_relu_inf_only) {
                                 uni_vmaxps(v, v, vzero);
                             } else if (with_relu) {
@@ -1028,6 +1066,7 @@ struct jit_bnorm_t : public jit_generator {
 
                 add(reg_src, vlen_spat_data_ * ch_blk_size);
                 add(reg_dst, vlen_spat_data_ * ch_blk_size);
+                if (with_add) add(reg_src_add, vlen_spat_data_ * ch_blk_size);
 
                 // advance mean_ptr() and var_ptr()
                 add(reg_coff, vlen * ch_blk_size);
@@ -1046,6 +1085,7 @@ struct jit_bnorm_t : public jit_generator {
         if (is_bf16_) shr(reg_coff_max, 1);
         sub(reg_src, reg_coff_max);
         sub(reg_dst, reg_coff_max);
+        if (with_add) sub(reg_src_add, reg_coff_max);
         if (is_bf16_) shl(reg_coff_max, 1);
 
         shr(reg_coff_max, 5);
@@ -1057,6 +1097,7 @@ struct jit_bnorm_t : public jit_generator {
         mov(reg_src, ptr[rsp + stack_off_src]);
         mov(reg_dst, ptr[rsp + stack_off_dst]);
         mov(reg_ws, ptr[rsp + stack_off_ws]);
+        if (with_add) mov(reg_src_add, ptr[rsp + stack_off_src_add]);
 
         xor_(reg_soff, reg_soff);
         Label dst_spatial;
@@ -1071,12 +1112,14 @@ struct jit_bnorm_t : public jit_generator {
                 mov(reg_soff, reg_tmp_off);
                 add(reg_src, vlen / 2);
                 add(reg_dst, vlen / 2);
+                if (with_add) add(reg_src_add, vlen / 2);
                 mov(reg_coff, vlen / 2);
 
                 forward_channels();
 
                 sub(reg_src, vlen / 2);
                 sub(reg_dst, vlen / 2);
+                if (with_add) sub(reg_src_add, vlen / 2);
             }
 
             // Process next image
@@ -1084,6 +1127,7 @@ struct jit_bnorm_t : public jit_generator {
                 // Can use static offset since we comeback after spatial loop
                 add(reg_src, mb_offt);
                 add(reg_dst, mb_offt);
+                if (with_add) add(reg_src_add, mb_offt);
                 add(reg_soff, mb_offt);
                 add(reg_ws, ws_mb_offt);
             } else {
@@ -1099,6 +1143,7 @@ struct jit_bnorm_t : public jit_generator {
             mov(reg_src, ptr[rsp + stack_off_src]);
             mov(reg_dst, ptr[rsp + stack_off_dst]);
             mov(reg_ws, ptr[rsp + stack_off_ws]);
+            if (with_add) mov(reg_src_add, ptr[rsp + stack_off_src_add]);
         }
     }
 
@@ -1313,6 +1358,12 @@ struct jit_bnorm_t : public jit_generator {
                                 else
                                     assert(false);
                             }
+                            if (with_add) {
+                                store_diff_src_add(
+                                        vmmword[reg_diff_src_add + reg_soff
+                                                + offt],
+                                        v, t);
+                            }
                             if (!bdesc_->use_global_stats()) {
                                 uni_vsubps(v, v, vdiff_beta);
                                 uni_vmovups_spat_data(
@@ -1416,6 +1467,12 @@ struct jit_bnorm_t : public jit_generator {
                             assert(false);
                     }
 
+                    if (with_add) {
+                        store_diff_src_add(vmmword[reg_diff_src_add
+                                                   + reg_soff_nspc + offt],
+                                Vmm(idx), Vmm(idx + 1));
+                    }
+
                     if (!bdesc_->use_global_stats()) {
                         uni_vsubps(Vmm(idx), Vmm(idx), vdiff_beta);
                         uni_vmovups_spat_data(Vmm(idx + 1),
@@ -1488,6 +1545,8 @@ struct jit_bnorm_t : public jit_generator {
                 if (!bdesc_->use_global_stats())
                     add(reg_src, vlen_spat_data_ * ch_blk_size);
                 add(reg_diff_src, vlen_spat_data_ * ch_blk_size);
+                if (with_add)
+                    add(reg_diff_src_add, vlen_spat_data_ * ch_blk_size);
 
                 // advance mean_ptr() and var_ptr()
                 add(reg_coff, vlen * ch_blk_size);
@@ -1508,6 +1567,7 @@ struct jit_bnorm_t : public jit_generator {
         sub(reg_diff_dst, reg_coff_max);
         if (!bdesc_->use_global_stats()) sub(reg_src, reg_coff_max);
         sub(reg_diff_src, reg_coff_max);
+        if (with_add) sub(reg_diff_src_add, reg_coff_max);
         if (is_bf16_) shl(reg_coff_max, 1);
 
         shr(reg_coff_max, 5);
@@ -1618,6 +1678,7 @@ struct jit_bnorm_t : public jit_generator {
             assert(isa == avx2 || isa == avx512_common);
             mov(reg_ws, ptr[rsp + stack_off_ws]);
         }
+        if (with_add) mov(reg_diff_src_add, ptr[rsp + stack_off_diff_src_add]);
 
         xor_(reg_soff, reg_soff);
         Label diff_spatial;
@@ -1643,6 +1704,7 @@ struct jit_bnorm_t : public jit_generator {
                 if (!bdesc_->use_global_stats()) add(reg_src, mb_offt);
                 add(reg_diff_dst, mb_offt);
                 add(reg_diff_src, mb_offt);
+                if (with_add) add(reg_diff_src_add, mb_offt);
                 add(reg_soff, mb_offt);
                 add(reg_ws, ws_mb_offt);
             } else {
@@ -1657,6 +1719,8 @@ struct jit_bnorm_t : public jit_generator {
                 mov(reg_src, ptr[rsp + stack_off_src]);
             mov(reg_diff_dst, ptr[rsp + stack_off_diff_dst]);
             mov(reg_diff_src, ptr[rsp + stack_off_diff_src]);
+            if (with_add)
+                mov(reg_diff_src_add, ptr[rsp + stack_off_diff_src_add]);
             if (with_relu) mov(reg_ws, ptr[rsp + stack_off_ws]);
         }
     }
@@ -1678,6 +1742,7 @@ struct jit_bnorm_t : public jit_generator {
         is_spatial_thr_ = bnorm_utils::is_spatial_thr(
                 bdesc_, is_nspc_, simd_w, dt_size);
         vlen_spat_data_ = vlen / (1 + is_bf16_); // 32B of BF16 -> 64B of FP32
+        with_add = bdesc_->fuse_norm_add_relu();
 
         unroll_blocks = isa == avx512_common && !is_spatial_thr_ ? 4 : 1;
         unroll_regs = isa == avx512_common && !is_spatial_thr_ ? 4 : 1;
@@ -1765,7 +1830,8 @@ struct driver_t : public c_compatible {
     }
 
     void exec(int ithr, int nthr, const void *src, void *diff_src, void *dst,
-            const void *diff_dst, const acc_data_t *scale_shift,
+            const void *diff_dst, const void *src_add, void *diff_src_add,
+            const acc_data_t *scale_shift,
             acc_data_t *diff_scale_shift, const acc_data_t *mean,
             const acc_data_t *var, const uint8_t *ws,
             const memory_tracking::grantor_t &scratchpad) {
@@ -1800,7 +1866,8 @@ struct driver_t : public c_compatible {
         dim_t C_blks_per_iter {1};
         int64_t iters {1};
         if (do_blocking_) {
-            int num_tensors = bdesc_->is_fwd() ? 1 : 2;
+            int num_tensors = (bdesc_->is_fwd() ? 1 : 2)
+                    + bdesc_->fuse_norm_add_relu();
             size_t working_set_size
                     = dt_size_ * (N * D * H * W * simd_w) * num_tensors;
             bnorm_utils::cache_balance(
@@ -1866,6 +1933,9 @@ struct driver_t : public c_compatible {
             p.dst = (void *)((char *)dst + soff_base * dt_size_);
             p.diff_src = (void *)((char *)diff_src + soff_base * dt_size_);
             p.diff_dst = (void *)((char *)diff_dst + soff_base * dt_size_);
+            p.src_add = (void *)((char *)src_add + soff_base * dt_size_);
+            p.diff_src_add
+                    = (void *)((char *)diff_src_add + soff_base * dt_size_);
             p.ws = ws + soff_base / 8;
 
             p.mb_stride_Bc = dt_size_ * (img_size - p.coff_max * p.spat_size);
@@ -1955,7 +2025,7 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::pd_t::init(engine_t *engine) {
             return status::unimplemented;
     }
 
-    if (is_training() && fuse_norm_relu()) {
+    if (is_training() && (fuse_norm_relu() || fuse_norm_add_relu())) {
         if (isa < avx2) return status::unimplemented;
         init_default_ws(1);
     }
@@ -1996,6 +2066,7 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::execute(
                     CTX_IN_MEM(const acc_data_t *, DNNL_ARG_VARIANCE))
             : CTX_OUT_MEM(acc_data_t *, DNNL_ARG_VARIANCE);
 
+    auto src_add = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
     auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
     auto ws = CTX_OUT_MEM(uint8_t *, DNNL_ARG_WORKSPACE);
 
@@ -2004,8 +2075,8 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::execute(
     bnorm_driver_->init_barriers(scratchpad);
 
     parallel(0, [&](const int ithr, const int nthr) {
-        bnorm_driver_->exec(ithr, nthr, src, nullptr, dst, nullptr, scale_shift,
-                nullptr, mean, var, ws, scratchpad);
+        bnorm_driver_->exec(ithr, nthr, src, nullptr, dst, nullptr, src_add,
+                nullptr, scale_shift, nullptr, mean, var, ws, scratchpad);
     });
 
     return status::success;
@@ -2058,7 +2129,7 @@ status_t jit_uni_batch_normalization_bwd_t<isa>::pd_t::init(engine_t *engine) {
         return status::unimplemented;
     }
 
-    if (fuse_norm_relu()) {
+    if (fuse_norm_relu() || fuse_norm_add_relu()) {
         if (isa < avx2) return status::unimplemented;
         init_default_ws(1);
         if (!compare_ws(hint_fwd_pd_)) return status::unimplemented;
@@ -2090,6 +2161,7 @@ status_t jit_uni_batch_normalization_bwd_t<isa>::execute(
     auto ws = CTX_IN_MEM(const uint8_t *, DNNL_ARG_WORKSPACE);
 
     auto diff_src = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_SRC);
+    auto diff_src_add = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_SRC_1);
     auto diff_scale_shift
             = CTX_OUT_MEM(acc_data_t *, DNNL_ARG_DIFF_SCALE_SHIFT);
 
@@ -2099,7 +2171,8 @@ status_t jit_uni_batch_normalization_bwd_t<isa>::execute(
 
     parallel(0, [&](const int ithr, const int nthr) {
         bnorm_driver_->exec(ithr, nthr, src, diff_src, nullptr, diff_dst,
-                scale_shift, diff_scale_shift, mean, var, ws, scratchpad);
+                nullptr, diff_src_add, scale_shift, diff_scale_shift, mean, var,
+                ws, scratchpad);
     });
 
     return status::success;
@@ -77,20 +77,34 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
         // transform input to blocked f32, call f32 jit, transform result to
         // plain output
         jpp.is_bf16 = false;
+        jpp.is_int8 = false;
         jpp.dt_size = types::data_type_size(data_type::f32);
         jpp.tag_kind = jptg_ncsp;
     } else {
         jpp.is_bf16 = (src_d.data_type() == data_type::bf16
                 && dst_d.data_type() == data_type::bf16);
+        jpp.is_int8 = utils::one_of(src_d.data_type(), data_type::s8,
+                data_type::u8);
         jpp.dt_size = types::data_type_size(src_d.data_type());
         jpp.tag_kind = (fmt_tag == nspc_fmt_tag) ? jptg_nspc : jptg_blocked;
     }
 
-    jpp.isa = (jpp.is_bf16 && mayiuse(avx512_core_bf16)) ? avx512_core_bf16
-                                                         : isa;
+    // bf16 and int8 on avx rely on the avx2 integer instructions
+    const bool is_avx2 = isa == avx && mayiuse(avx2);
+
+    jpp.src_dt = src_d.data_type();
+    if (jpp.is_bf16 && isa == avx512_core && mayiuse(avx512_core_bf16))
+        jpp.isa = avx512_core_bf16;
+    else if ((jpp.is_bf16 || jpp.is_int8) && is_avx2)
+        jpp.isa = avx2;
+    else
+        jpp.isa = isa;
 
     const bool args_ok = true && mayiuse(isa) && (fmt_tag != format_tag::undef)
-            && IMPLICATION(jpp.is_bf16, mayiuse(avx512_core))
+            && IMPLICATION(jpp.is_bf16,
+                    is_avx2 || (isa == avx512_core && mayiuse(avx512_core)))
+            && IMPLICATION(jpp.is_int8,
+                    is_avx2 && jpp.is_backward && pd.alg_kind == pooling_max)
             && utils::one_of(pd.alg_kind, pooling_max,
                     pooling_avg_include_padding, pooling_avg_exclude_padding);
     if (!args_ok) return status::unimplemented;
@@ -134,6 +148,14 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
             || right_pad >= jpp.kw)
         return status::unimplemented;
 
+    // The int8 gradients are only propagated when every diff_src point
+    // belongs to a single window: the accumulation of the overlapping windows
+    // would be saturated in the middle otherwise.
+    if (jpp.is_int8
+            && (jpp.kd > jpp.stride_d || jpp.kh > jpp.stride_h
+                    || jpp.kw > jpp.stride_w))
+        return status::unimplemented;
+
     jpp.alg = pd.alg_kind;
 
     jpp.ind_dt = ppd->workspace_md() ? ppd->workspace_md()->data_type
@@ -159,9 +181,15 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
             jpp.ur = is_avx512 ? 24 : 12;
     }
     if (jpp.is_bf16) {
-        jpp.ur = (!isa_has_bf16(jpp.isa))
-                ? jpp.ur - 4 // Free registers for AVX512 emulation
-                : jpp.ur - 1; // Free register for cvt from bf16 to f32
+        if (isa == avx) {
+            // Free registers for the conversion to bf16, max pooling does not
+            // use them while the result is stored
+            if (jpp.alg != pooling_max) jpp.ur -= 2;
+        } else {
+            jpp.ur = (!isa_has_bf16(jpp.isa))
+                    ? jpp.ur - 4 // Free registers for AVX512 emulation
+                    : jpp.ur - 1; // Free register for cvt from bf16 to f32
+        }
     }
 
     // select jpp.ur_bc
@@ -222,6 +250,72 @@ status_t jit_uni_pool_kernel<isa>::init_conf(jit_pool_conf_t &jpp,
     return status::success;
 }
 
+template <cpu_isa_t isa>
+inline void jit_uni_pool_kernel<isa>::load(
+        const Vmm &vmm, const Xbyak::Address &addr) {
+    if (jpp.is_bf16) {
+        if (isa == avx) {
+            vpmovzxwd(vmm, addr);
+            vpslld(vmm, vmm, 16);
+        } else {
+            vmovups(Ymm(vmm.getIdx()), addr);
+            vpermw(vmm | k_mask_cvt | T_z, vmm_idx(), vmm);
+        }
+    } else if (jpp.is_int8) {
+        if (jpp.src_dt == data_type::s8)
+            vpmovsxbd(vmm, addr);
+        else
+            vpmovzxbd(vmm, addr);
+        vcvtdq2ps(vmm, vmm);
+    } else {
+        uni_vmovups(vmm, addr);
+    }
+}
+
+template <cpu_isa_t isa>
+inline void jit_uni_pool_kernel<isa>::store(
+        int idx, const Xbyak::Address &addr) {
+    auto vr = vreg(idx);
+    auto yr = yreg(idx);
+    auto xr = xreg(idx);
+    if (jpp.is_bf16) {
+        if (isa == avx) {
+            // Round to nearest even, NaN is quieted and truncated
+            const int vlen = cpu_isa_traits<isa>::vlen;
+            vpsrld(vmm_cvt_tmp_1, vr, 16);
+            vpand(vmm_cvt_tmp_1, vmm_cvt_tmp_1, ptr[reg_cvt_table]);
+            vpaddd(vmm_cvt_tmp_1, vmm_cvt_tmp_1, ptr[reg_cvt_table + vlen]);
+            vcmpunordps(vmm_cvt_tmp_2, vr, vr);
+            vpandn(vmm_cvt_tmp_1, vmm_cvt_tmp_2, vmm_cvt_tmp_1);
+            vpand(vmm_cvt_tmp_2, vmm_cvt_tmp_2,
+                    ptr[reg_cvt_table + 2 * vlen]);
+            vpor(vr, vr, vmm_cvt_tmp_2);
+            vpaddd(vr, vr, vmm_cvt_tmp_1);
+            vpsrld(vr, vr, 16);
+            vpackusdw(vr, vr, vr);
+            vpermq(yr, yr, 0xd8);
+            vmovdqu(addr, xr);
+        } else {
+            if (!isa_has_bf16(jpp.isa))
+                bf16_emu_->vcvtneps2bf16(yr, zreg(idx));
+            else
+                vcvtneps2bf16(yr, vr);
+            vmovdqu16(addr, yr);
+        }
+    } else if (jpp.is_int8) {
+        vcvtps2dq(vr, vr);
+        vpackssdw(vr, vr, vr);
+        vpermq(yr, yr, 0x08);
+        if (jpp.src_dt == data_type::s8)
+            vpacksswb(xr, xr, xr);
+        else
+            vpackuswb(xr, xr, xr);
+        vmovq(addr, xr);
+    } else {
+        uni_vmovups(addr, vr);
+    }
+}
+
 template <cpu_isa_t isa>
 inline void jit_uni_pool_kernel<isa>::maybe_recalculate_divisor(
         int jj, int ur_w, int pad_l, int pad_r) {
@@ -304,25 +398,12 @@ inline void jit_uni_pool_kernel<isa>::avg_step(
                 if (aux_input_offset >= iw * c_off) continue;
                 int input_offset = dt_size * aux_input_offset;
                 if (jpp.is_backward) {
-                    auto inpyr = yreg(inpr_i);
                     load(inpr_i, aux_reg_input, input_offset);
                     uni_vaddps(inpvr, inpvr, accvr);
-                    if (jpp.is_bf16) {
-                        if (!isa_has_bf16(jpp.isa))
-                            bf16_emu_->vcvtneps2bf16(inpyr, zreg(inpr_i));
-                        else
-                            vcvtneps2bf16(inpyr, inpvr);
-                        vmovdqu16(ptr[aux_reg_input + input_offset], inpyr);
-                    } else {
-                        uni_vmovups(
-                                vmmword[aux_reg_input + input_offset], inpvr);
-                    }
+                    store(inpr_i, ptr[aux_reg_input + input_offset]);
                 } else {
                     if (jpp.is_bf16) {
-                        vmovups(ymm_tmp_1, ptr[aux_reg_input + input_offset]);
-                        vpermw(vmm_tmp_1 | k_mask_cvt | T_z, vmm_idx(),
-                                vmm_tmp_1);
-
+                        load(vmm_tmp_1, ptr[aux_reg_input + input_offset]);
                         uni_vaddps(accvr, accvr, vmm_tmp_1);
                     } else {
                         uni_vaddps(accvr, accvr,
@@ -354,17 +435,7 @@ inline void jit_uni_pool_kernel<isa>::avg_step(
                 auto accvr = vreg(accr_i);
                 auto output_offset = dt_size * (jj * c_off + bci * c_block);
                 uni_vdivps(accvr, accvr, vmm_tmp);
-                if (jpp.is_bf16) {
-                    auto acczr = zreg(accr_i);
-                    auto accyr = yreg(accr_i);
-                    if (!isa_has_bf16(jpp.isa))
-                        bf16_emu_->vcvtneps2bf16(accyr, acczr);
-                    else
-                        vcvtneps2bf16(accyr, accvr);
-                    vmovdqu16(ptr[reg_output + output_offset], accyr);
-                } else {
-                    uni_vmovups(vmmword[reg_output + output_offset], accvr);
-                }
+                store(accr_i, ptr[reg_output + output_offset]);
             }
         }
     }
@@ -485,19 +556,8 @@ inline void jit_uni_pool_kernel<isa>::max_step_fwd(
     for_(int jj = 0; jj < ur_w; jj++)
     for (int bci = 0; bci < ur_bc; bci++) {
         auto accr_i = reg_ind(0, bci, jj);
-        auto accvr = vreg(accr_i);
         auto output_offset = jpp.dt_size * (jj * c_off + bci * c_block);
-        if (jpp.is_bf16) {
-            auto acczr = zreg(accr_i);
-            auto accyr = yreg(accr_i);
-            if (!isa_has_bf16(jpp.isa))
-                bf16_emu_->vcvtneps2bf16(accyr, acczr);
-            else
-                vcvtneps2bf16(accyr, accvr);
-            vmovups(ptr[reg_output + output_offset], accyr);
-        } else {
-            uni_vmovups(vmmword[reg_output + output_offset], accvr);
-        }
+        store(accr_i, ptr[reg_output + output_offset]);
         if (jpp.is_training) {
             const size_t step_index = (jj * c_off + bci * c_block)
                     * types::data_type_size(jpp.ind_dt);
@@ -640,24 +700,22 @@ inline void jit_uni_pool_kernel<isa>::max_step_bwd(
                     } else {
                         avx_pcmpeqd(cvtvr, indvr, vmm_k_offset, xmm_tmp);
                     }
-                    vaddps(inpvr, inpvr, outvr);
-                    vmaskmovps(
-                            vmmword[aux_reg_input + inp_offset], cvtvr, inpvr);
+                    if (jpp.is_bf16 || jpp.is_int8) {
+                        // There is no masked store for the narrow types, the
+                        // gradient is zeroed for the other points instead
+                        vandps(cvtvr, cvtvr, outvr);
+                        vaddps(inpvr, inpvr, cvtvr);
+                        store(inpr_i, ptr[aux_reg_input + inp_offset]);
+                    } else {
+                        vaddps(inpvr, inpvr, outvr);
+                        vmaskmovps(vmmword[aux_reg_input + inp_offset], cvtvr,
+                                inpvr);
+                    }
                 } else {
-                    auto indzr = zreg(inpr_i);
-                    auto indyr = yreg(inpr_i);
                     vpcmpeqd(k_store_mask, indvr, vmm_k_offset);
                     vblendmps(vmm_tmp | k_store_mask | T_z, outvr, outvr);
                     vaddps(inpvr, inpvr, vmm_tmp);
-                    if (jpp.is_bf16) {
-                        if (!isa_has_bf16(jpp.isa))
-                            bf16_emu_->vcvtneps2bf16(indyr, indzr);
-                        else
-                            vcvtneps2bf16(indyr, inpvr);
-                        vmovdqu16(ptr[aux_reg_input + inp_offset], indyr);
-                    } else {
-                        vmovups(vmmword[aux_reg_input + inp_offset], inpvr);
-                    }
+                    store(inpr_i, ptr[aux_reg_input + inp_offset]);
                 }
             }
             if (isa == avx && !mayiuse(avx2)) {
@@ -735,9 +793,14 @@ void jit_uni_pool_kernel<isa>::zero_diff_src(int ur_bc) {
             for_(int i = 0; i < width_size; i += step)
             for (int bci = 0; bci < ur_bc; bci++) {
                 const int offs = i + bci * jpp.c_block * jpp.dt_size;
-                if (jpp.is_bf16)
-                    vmovdqu16(ptr[reg_zero_ptr + offs], yzero);
-                else {
+                if (jpp.is_bf16) {
+                    if (isa == avx)
+                        vmovdqu(ptr[reg_zero_ptr + offs], xmm_tmp);
+                    else
+                        vmovdqu16(ptr[reg_zero_ptr + offs], yzero);
+                } else if (jpp.is_int8) {
+                    vmovq(ptr[reg_zero_ptr + offs], xmm_tmp);
+                } else {
                     uni_vmovups(ptr[reg_zero_ptr + offs], vzero);
                     if (isa == sse41)
                         uni_vmovups(ptr[reg_zero_ptr + offs + vlen], vzero);
@@ -761,7 +824,7 @@ void jit_uni_pool_kernel<isa>::generate() {
 
     this->preamble();
 
-    Label idx_table;
+    Label idx_table, cvt_table;
 
     int ow = jpp.ow;
     int iw = jpp.iw;
@@ -781,7 +844,7 @@ void jit_uni_pool_kernel<isa>::generate() {
     xor_(rcx, rdi);
     xor_(rdi, rcx);
 #endif
-    if (!isa_has_bf16(jpp.isa) && jpp.is_bf16) bf16_emu_->init_vcvtneps2bf16();
+    if (use_bf16_emulation()) bf16_emu_->init_vcvtneps2bf16();
 
     mov(reg_input, ptr[reg_param + GET_OFF(src)]);
     mov(reg_output, ptr[reg_param + GET_OFF(dst)]);
@@ -792,7 +855,9 @@ void jit_uni_pool_kernel<isa>::generate() {
     mov(reg_ker_area_h, ptr[reg_param + GET_OFF(ker_area_h)]);
     mov(reg_nbc, ptr[reg_param + GET_OFF(ur_bc)]);
 
-    if (jpp.is_bf16) {
+    if (jpp.is_bf16 && isa == avx) {
+        mov(reg_cvt_table, cvt_table);
+    } else if (jpp.is_bf16) {
         mov(tmp_gpr.cvt32(), 0xAAAAAAAA);
         kmovd(k_mask_cvt, tmp_gpr.cvt32());
 
@@ -905,7 +970,15 @@ void jit_uni_pool_kernel<isa>::generate() {
 
     this->postamble();
 
-    if (jpp.is_bf16) {
+    if (jpp.is_bf16 && isa == avx) {
+        align(64);
+        L(cvt_table);
+        // rounding bit mask, rounding bias and quiet NaN bit
+        const uint32_t cvt_consts[] = {0x1, 0x7fff, 0x400000};
+        for (size_t i = 0; i < sizeof(cvt_consts) / sizeof(cvt_consts[0]); ++i)
+            for (int j = 0; j < vlen / 4; ++j)
+                dd(cvt_consts[i]);
+    } else if (jpp.is_bf16) {
         align(64);
         L(idx_table);
         const uint16_t _idx[] = {0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7,
@@ -36,7 +36,7 @@ namespace x64 {
 template <cpu_isa_t isa>
 struct jit_uni_pool_kernel : public jit_generator {
     jit_uni_pool_kernel(jit_pool_conf_t ajpp) : jpp(ajpp), bf16_emu_(nullptr) {
-        if (jpp.is_bf16 && !isa_has_bf16(jpp.isa))
+        if (use_bf16_emulation())
             bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
                     bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_reserv_4,
                     bf16_emu_reserv_5);
@@ -105,6 +105,12 @@ private:
     Reg64 bf16_emu_reserv_4 = r11;
     Zmm bf16_emu_reserv_5 = Zmm(8);
 
+    // AVX2 has no bf16 instructions, the conversion is done with integer
+    // operations (see store()). The registers are only live during a store.
+    Vmm vmm_cvt_tmp_1 = Vmm(4);
+    Vmm vmm_cvt_tmp_2 = Vmm(5);
+    Reg64 reg_cvt_table = r11;
+
     Opmask k_index_mask = Opmask(6);
     Opmask k_store_mask = Opmask(7);
     Opmask k_mask_cvt = Opmask(5);
@@ -154,16 +160,15 @@ private:
 
     void zero_diff_src(int ur_bc);
 
+    bool use_bf16_emulation() const {
+        return jpp.is_bf16 && isa == avx512_core && !isa_has_bf16(jpp.isa);
+    }
+
+    void load(const Vmm &vmm, const Xbyak::Address &addr);
     void load(int idx, reg64_t reg_ptr, int offset) {
-        if (jpp.is_bf16) {
-            /*TODO: maybe use vpmovzxwd + vpslld,
-             * in order to free up vmm_idx() register */
-            vmovups(yreg(idx), ptr[reg_ptr + offset]);
-            vpermw(vreg(idx) | k_mask_cvt | T_z, vmm_idx(), vreg(idx));
-        } else {
-            uni_vmovups(vreg(idx), ptr[reg_ptr + offset]);
-        }
+        load(vreg(idx), ptr[reg_ptr + offset]);
     };
+    void store(int idx, const Xbyak::Address &addr);
 
     void step(int ur_w, int ur_bc, int pad_l, int pad_r) {
         if (jpp.alg == alg_kind::pooling_max) {
@@ -979,6 +979,10 @@ template struct jit_uni_pooling_fwd_t<sse41, data_type::f32>;
 template struct jit_uni_pooling_bwd_t<sse41, data_type::f32>;
 template struct jit_uni_pooling_fwd_t<avx, data_type::f32>;
 template struct jit_uni_pooling_bwd_t<avx, data_type::f32>;
+template struct jit_uni_pooling_fwd_t<avx, data_type::bf16>;
+template struct jit_uni_pooling_bwd_t<avx, data_type::bf16>;
+template struct jit_uni_pooling_bwd_t<avx, data_type::s8>;
+template struct jit_uni_pooling_bwd_t<avx, data_type::u8>;
 template struct jit_uni_pooling_fwd_t<avx512_common, data_type::f32>;
 template struct jit_uni_pooling_bwd_t<avx512_common, data_type::f32>;
 template struct jit_uni_pooling_fwd_t<avx512_core, data_type::bf16>;
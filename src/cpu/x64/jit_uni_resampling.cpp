@@ -0,0 +1,559 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <limits.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_uni_eltwise_injector.hpp"
+
+#include "cpu/x64/jit_uni_resampling.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace resampling_utils;
+
+#define GET_OFF(field) offsetof(jit_uni_resampling_args_t, field)
+struct jit_uni_resampling_args_t {
+    const void *src[4]; // src rows of the d and h corners
+    void *dst; // dst row
+    const int32_t *w_off; // byte offsets of the w taps, [taps][OW]
+    const float *w_wei; // weights of the w taps, [taps][OW]
+    float wei[4]; // weights of the d and h corners
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_resampling_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_resampling_kernel_t)
+
+    using Vmm = typename utils::conditional<isa == sse41, Xmm, Ymm>::type;
+
+    jit_uni_resampling_kernel_t(const resampling_pd_t *pd)
+        : jit_generator(), pd_(pd) {
+        const memory_desc_wrapper src_d(pd_->src_md());
+        inner_stride_ = src_d.blocking_desc().strides[pd_->ndims() - 1];
+        is_linear_ = pd_->desc()->alg_kind == alg_kind::resampling_linear;
+        n_taps_ = is_linear_ ? 2 : 1;
+        n_corners_ = is_linear_ ? 1 << (pd_->ndims() - 3) : 1;
+        src_dt_ = pd_->src_md()->data_type;
+        dst_dt_ = pd_->dst_md()->data_type;
+        src_dt_size_ = types::data_type_size(src_dt_);
+        dst_dt_size_ = types::data_type_size(dst_dt_);
+        oscale_ = pd_->attr()->output_scales_.scales_[0];
+
+        const auto &po = pd_->attr()->post_ops_;
+        for (int idx = 0; idx < po.len_; idx++) {
+            const auto &e = po.entry_[idx];
+            if (e.is_eltwise())
+                eltwise_injectors_[idx].reset(
+                        new jit_uni_eltwise_injector_f32<isa>(
+                                this, e.eltwise, true, reg_tmp));
+            else
+                sum_scale_ = e.sum.scale;
+        }
+
+        generate();
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+    void operator()(const jit_uni_resampling_args_t *args) const {
+        assert(ker_);
+        ker_(args);
+    }
+
+private:
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    using RegExp = Xbyak::RegExp;
+
+    Reg64 reg_src(int i) const { return Reg64(r8.getIdx() + i); }
+    Reg64 reg_off(int k) const { return k == 0 ? rdx : rbp; }
+    Vmm vmm_idx(int k) const { return Vmm(4 + k); }
+    Vmm vmm_wei(int k) const { return Vmm(6 + k); }
+    Vmm vmm_corner_wei(int i) const { return Vmm(8 + i); }
+
+    // offset of the k-th w tap in the tables
+    dim_t tap_off(int k) const { return k * pd_->OW() * sizeof(float); }
+
+    void gather(const Vmm &vmm, const Reg64 &src, const Vmm &idx) {
+        if (isa == avx2) {
+            vpcmpeqd(vmm_mask, vmm_mask, vmm_mask);
+            vgatherdps(vmm, ptr[src + idx], vmm_mask);
+        } else {
+            for (int j = 0; j < simd_w; j++) {
+                pextrd(reg_tmp.cvt32(), Xmm(idx.getIdx()), j);
+                insertps(Xmm(vmm.getIdx()), ptr[src + reg_tmp], j << 4);
+            }
+        }
+    }
+
+    void extend_bytes(const Vmm &vmm, const Operand &op, bool is_signed) {
+        if (isa == sse41) {
+            if (is_signed)
+                pmovsxbd(Xmm(vmm.getIdx()), op);
+            else
+                pmovzxbd(Xmm(vmm.getIdx()), op);
+        } else {
+            if (is_signed)
+                vpmovsxbd(vmm, op);
+            else
+                vpmovzxbd(vmm, op);
+        }
+    }
+
+    // loads the values of the data type and converts them to f32
+    void load(const Vmm &vmm, const RegExp &addr, data_type_t dt,
+            bool scalar) {
+        using namespace data_type;
+        const Xmm xmm(vmm.getIdx());
+        if (dt == f32) {
+            if (scalar)
+                uni_vmovss(xmm, ptr[addr]);
+            else
+                uni_vmovups(vmm, ptr[addr]);
+            return;
+        }
+
+        if (scalar) {
+            // a single value is inserted into the lowest byte first
+            if (isa == sse41)
+                pinsrb(xmm, byte[addr], 0);
+            else
+                vpinsrb(xmm, xmm, byte[addr], 0);
+            extend_bytes(vmm, xmm, dt == s8);
+        } else {
+            extend_bytes(vmm, ptr[addr], dt == s8);
+        }
+        uni_vcvtdq2ps(vmm, vmm);
+    }
+
+    void load_tap(int i, int k, bool scalar, bool use_gather) {
+        if (use_gather && !scalar)
+            gather(vmm_src, reg_src(i), vmm_idx(k));
+        else
+            load(vmm_src, reg_src(i) + reg_off(k), src_dt_, scalar);
+    }
+
+    // returns the register with the interpolated values
+    Vmm interpolate(bool scalar, bool use_gather) {
+        if (!is_linear_) {
+            load_tap(0, 0, scalar, use_gather);
+            return vmm_src;
+        }
+
+        if (n_corners_ > 1) uni_vpxor(vmm_acc, vmm_acc, vmm_acc);
+        for (int i = 0; i < n_corners_; i++) {
+            uni_vpxor(vmm_row, vmm_row, vmm_row);
+            for (int k = 0; k < n_taps_; k++) {
+                load_tap(i, k, scalar, use_gather);
+                uni_vfmadd231ps(vmm_row, vmm_src, vmm_wei(k));
+            }
+            if (n_corners_ == 1) return vmm_row;
+            uni_vfmadd231ps(vmm_acc, vmm_row, vmm_corner_wei(i));
+        }
+        return vmm_acc;
+    }
+
+    void apply_attr(const Vmm &vmm, bool scalar) {
+        if (oscale_ != 1.f) uni_vmulps(vmm, vmm, vmm_oscale);
+
+        const auto &po = pd_->attr()->post_ops_;
+        for (int idx = 0; idx < po.len_; idx++) {
+            if (po.entry_[idx].is_eltwise()) {
+                eltwise_injectors_[idx]->compute_vector(vmm.getIdx());
+                continue;
+            }
+            load(vmm_tmp, reg_dst, dst_dt_, scalar);
+            if (sum_scale_ != 1.f)
+                uni_vfmadd231ps(vmm, vmm_tmp, vmm_sum_scale);
+            else
+                uni_vaddps(vmm, vmm, vmm_tmp);
+        }
+    }
+
+    // converts the f32 values to the dst data type and stores them
+    void store(const Vmm &vmm, bool scalar) {
+        using namespace data_type;
+        const Xmm xmm(vmm.getIdx());
+        if (dst_dt_ == f32) {
+            if (scalar)
+                uni_vmovss(ptr[reg_dst], xmm);
+            else
+                uni_vmovups(ptr[reg_dst], vmm);
+            return;
+        }
+
+        // cvtps2dq does not saturate on the upper bound, the lower bound and
+        // the narrowing are handled by the saturating packs
+        uni_vminps(vmm, vmm, vmm_ubound);
+        uni_vcvtps2dq(vmm, vmm);
+        const bool is_signed = dst_dt_ == s8;
+        if (isa == sse41) {
+            packssdw(xmm, xmm);
+            if (is_signed)
+                packsswb(xmm, xmm);
+            else
+                packuswb(xmm, xmm);
+            if (scalar)
+                pextrb(ptr[reg_dst], xmm, 0);
+            else
+                movd(ptr[reg_dst], xmm);
+        } else {
+            const Xmm xmm_hi = scalar ? xmm : Xmm(vmm_tmp.getIdx());
+            if (!scalar) vextracti128(xmm_hi, Ymm(vmm.getIdx()), 1);
+            vpackssdw(xmm, xmm, xmm_hi);
+            if (is_signed)
+                vpacksswb(xmm, xmm, xmm);
+            else
+                vpackuswb(xmm, xmm, xmm);
+            if (scalar)
+                vpextrb(ptr[reg_dst], xmm, 0);
+            else
+                vmovq(ptr[reg_dst], xmm);
+        }
+    }
+
+    void compute(bool scalar, bool use_gather) {
+        const Vmm vmm = interpolate(scalar, use_gather);
+        apply_attr(vmm, scalar);
+        store(vmm, scalar);
+    }
+
+    void broadcast(const Vmm &vmm, float value) {
+        const Xmm xmm(vmm.getIdx());
+        mov(reg_tmp.cvt32(), float2int(value));
+        if (isa == sse41)
+            movd(xmm, reg_tmp.cvt32());
+        else
+            vmovd(xmm, reg_tmp.cvt32());
+        uni_vbroadcastss(vmm, xmm);
+    }
+
+    // channels last and blocked layouts: the channels are vectorized
+    void compute_row_channels() {
+        const int n_vecs = inner_stride_ / simd_w;
+        const int tail = inner_stride_ % simd_w;
+
+        auto compute = [&](bool scalar) {
+            this->compute(scalar, false);
+            const int step = scalar ? 1 : simd_w;
+            for (int k = 0; k < n_taps_; k++)
+                add(reg_off(k), step * src_dt_size_);
+            add(reg_dst, step * dst_dt_size_);
+        };
+
+        Label ow_loop, c_loop;
+        mov(reg_ow, pd_->OW());
+        L(ow_loop);
+        {
+            for (int k = 0; k < n_taps_; k++) {
+                mov(reg_off(k).cvt32(), dword[reg_w_off + tap_off(k)]);
+                if (is_linear_)
+                    uni_vbroadcastss(vmm_wei(k), ptr[reg_w_wei + tap_off(k)]);
+            }
+
+            if (n_vecs <= max_unroll) {
+                for (int v = 0; v < n_vecs; v++)
+                    compute(false);
+            } else {
+                mov(reg_c, n_vecs);
+                L(c_loop);
+                {
+                    compute(false);
+                    dec(reg_c);
+                    jnz(c_loop, T_NEAR);
+                }
+            }
+            for (int t = 0; t < tail; t++)
+                compute(true);
+
+            add(reg_w_off, sizeof(int32_t));
+            if (is_linear_) add(reg_w_wei, sizeof(float));
+            dec(reg_ow);
+            jnz(ow_loop, T_NEAR);
+        }
+    }
+
+    // plain f32 layouts: the w dimension is vectorized, the src values are
+    // gathered with the offsets from the table
+    void compute_row_plain() {
+        const int n_vecs = pd_->OW() / simd_w;
+        const int tail = pd_->OW() % simd_w;
+
+        auto compute = [&](bool scalar) {
+            for (int k = 0; k < n_taps_; k++) {
+                if (scalar) {
+                    mov(reg_off(k).cvt32(), dword[reg_w_off + tap_off(k)]);
+                    if (is_linear_)
+                        uni_vmovss(vmm_wei(k), ptr[reg_w_wei + tap_off(k)]);
+                } else {
+                    uni_vmovups(vmm_idx(k), ptr[reg_w_off + tap_off(k)]);
+                    if (is_linear_)
+                        uni_vmovups(vmm_wei(k), ptr[reg_w_wei + tap_off(k)]);
+                }
+            }
+            this->compute(scalar, true);
+
+            const int step = scalar ? sizeof(float) : vlen;
+            add(reg_w_off, step);
+            if (is_linear_) add(reg_w_wei, step);
+            add(reg_dst, step);
+        };
+
+        if (n_vecs > 0) {
+            Label ow_loop;
+            mov(reg_ow, n_vecs);
+            L(ow_loop);
+            {
+                compute(false);
+                dec(reg_ow);
+                jnz(ow_loop, T_NEAR);
+            }
+        }
+        for (int t = 0; t < tail; t++)
+            compute(true);
+    }
+
+    void generate() {
+        preamble();
+
+        for (int i = 0; i < n_corners_; i++)
+            mov(reg_src(i), ptr[reg_param + GET_OFF(src) + i * sizeof(void *)]);
+        mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+        mov(reg_w_off, ptr[reg_param + GET_OFF(w_off)]);
+        if (is_linear_) mov(reg_w_wei, ptr[reg_param + GET_OFF(w_wei)]);
+        if (n_corners_ > 1) {
+            for (int i = 0; i < n_corners_; i++)
+                uni_vbroadcastss(vmm_corner_wei(i),
+                        ptr[reg_param + GET_OFF(wei) + i * sizeof(float)]);
+        }
+
+        if (oscale_ != 1.f) broadcast(vmm_oscale, oscale_);
+        if (sum_scale_ != 1.f) broadcast(vmm_sum_scale, sum_scale_);
+        if (dst_dt_ != data_type::f32)
+            broadcast(vmm_ubound, types::max_value<float>(dst_dt_));
+
+        // the gathers are used for f32 only, the other data types go through
+        // the channels path that handles a single channel as a tail
+        const bool use_gather = inner_stride_ == 1
+                && utils::everyone_is(data_type::f32, src_dt_, dst_dt_);
+        if (use_gather)
+            compute_row_plain();
+        else
+            compute_row_channels();
+
+        postamble();
+
+        for (auto &inj : eltwise_injectors_)
+            if (inj) inj->prepare_table();
+    }
+
+    const resampling_pd_t *pd_;
+    void (*ker_)(const jit_uni_resampling_args_t *) = nullptr;
+
+    enum { max_unroll = 4 };
+    const int vlen = cpu_isa_traits<isa>::vlen;
+
+    dim_t inner_stride_;
+    bool is_linear_;
+    int n_taps_;
+    int n_corners_;
+    data_type_t src_dt_;
+    data_type_t dst_dt_;
+    int src_dt_size_;
+    int dst_dt_size_;
+    float oscale_;
+    float sum_scale_ = 1.f;
+    std::unique_ptr<jit_uni_eltwise_injector_f32<isa>>
+            eltwise_injectors_[dnnl_post_ops::capacity];
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_dst = rbx;
+    Reg64 reg_w_off = r12;
+    Reg64 reg_w_wei = r13;
+    Reg64 reg_ow = r14;
+    Reg64 reg_c = r15;
+    Reg64 reg_tmp = rax;
+
+    // Vmm(0) is reserved by the eltwise injector on sse41, hence the
+    // interpolation never returns the result in it
+    Vmm vmm_mask = Vmm(0);
+    Vmm vmm_tmp = Vmm(0);
+    Vmm vmm_src = Vmm(1);
+    Vmm vmm_row = Vmm(2);
+    Vmm vmm_acc = Vmm(3);
+    Vmm vmm_oscale = Vmm(12);
+    Vmm vmm_sum_scale = Vmm(13);
+    Vmm vmm_ubound = Vmm(14);
+};
+
+template <cpu_isa_t isa>
+status_t jit_uni_resampling_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+    using namespace data_type;
+    // a single register holds the scale of the sum post-op
+    const auto &po = attr()->post_ops_;
+    const int sum_idx = po.find(primitive_kind::sum);
+    const bool post_ops_ok
+            = sum_idx == -1 || po.find(primitive_kind::sum, sum_idx + 1) == -1;
+
+    bool ok = mayiuse(isa) && is_fwd() && !has_zero_dim_memory()
+            && utils::one_of(src_md()->data_type, f32, s8, u8)
+            && utils::one_of(dst_md()->data_type, f32, s8, u8)
+            && set_default_params() == status::success && attr_ok()
+            && post_ops_ok;
+    if (!ok) return status::unimplemented;
+
+    format_tag_t dat_tag = memory_desc_matches_one_of_tag(*src_md(), ncw, nchw,
+            ncdhw, nwc, nhwc, ndhwc, nCw8c, nChw8c, nCdhw8c, nCw16c, nChw16c,
+            nCdhw16c);
+    if (!memory_desc_matches_tag(*dst_md(), dat_tag))
+        return status::unimplemented;
+
+    // the offsets in a row of src and in the tables are 32-bit
+    const memory_desc_wrapper src_d(src_md());
+    const dim_t inner_stride = src_d.blocking_desc().strides[ndims() - 1];
+    const dim_t src_dt_size = types::data_type_size(src_md()->data_type);
+    if (IW() * inner_stride * src_dt_size > INT_MAX
+            || 2 * OW() * (dim_t)sizeof(float) > INT_MAX)
+        return status::unimplemented;
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+jit_uni_resampling_fwd_t<isa>::jit_uni_resampling_fwd_t(const pd_t *apd)
+    : primitive_t(apd) {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    inner_stride_ = src_d.blocking_desc().strides[pd()->ndims() - 1];
+    nsp_outer_ = src_d.nelems(true)
+            / (pd()->ID() * pd()->IH() * pd()->IW() * inner_stride_);
+    stride_d_ = pd()->IH() * pd()->IW() * inner_stride_;
+    stride_h_ = pd()->IW() * inner_stride_;
+
+    fill_coeffs();
+    kernel_.reset(new jit_uni_resampling_kernel_t<isa>(pd()));
+}
+
+template <cpu_isa_t isa>
+jit_uni_resampling_fwd_t<isa>::~jit_uni_resampling_fwd_t() = default;
+
+template <cpu_isa_t isa>
+void jit_uni_resampling_fwd_t<isa>::fill_coeffs() {
+    const bool is_linear
+            = pd()->desc()->alg_kind == alg_kind::resampling_linear;
+    const dim_t OW = pd()->OW();
+    const dim_t w_stride
+            = inner_stride_ * types::data_type_size(pd()->src_md()->data_type);
+
+    if (is_linear) {
+        linear_coeffs_.reserve(pd()->OD() + pd()->OH());
+        for (dim_t od = 0; od < pd()->OD(); od++)
+            linear_coeffs_.push_back(
+                    linear_coeffs_t(od, pd()->FD(), pd()->ID()));
+        for (dim_t oh = 0; oh < pd()->OH(); oh++)
+            linear_coeffs_.push_back(
+                    linear_coeffs_t(oh, pd()->FH(), pd()->IH()));
+
+        w_offsets_.resize(2 * OW);
+        w_weights_.resize(2 * OW);
+        for (dim_t ow = 0; ow < OW; ow++) {
+            const linear_coeffs_t iw(ow, pd()->FW(), pd()->IW());
+            for (int k = 0; k < 2; k++) {
+                w_offsets_[k * OW + ow] = (int32_t)(iw.idx[k] * w_stride);
+                w_weights_[k * OW + ow] = iw.wei[k];
+            }
+        }
+    } else {
+        w_offsets_.resize(OW);
+        for (dim_t ow = 0; ow < OW; ow++)
+            w_offsets_[ow] = (int32_t)(nearest_idx(ow, pd()->FW()) * w_stride);
+    }
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_resampling_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    const dim_t src_dt_size = types::data_type_size(pd()->src_md()->data_type);
+    const dim_t dst_dt_size = types::data_type_size(pd()->dst_md()->data_type);
+
+    const dim_t OD = pd()->OD();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t ID = pd()->ID();
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+    const int ndims = pd()->ndims();
+    const bool is_linear
+            = pd()->desc()->alg_kind == alg_kind::resampling_linear;
+
+    parallel_nd(nsp_outer_, OD, OH, [&](dim_t nsp, dim_t od, dim_t oh) {
+        const char *src_sp
+                = src + nsp * ID * IH * IW * inner_stride_ * src_dt_size;
+
+        jit_uni_resampling_args_t args;
+        args.dst = dst
+                + ((nsp * OD + od) * OH + oh) * OW * inner_stride_
+                        * dst_dt_size;
+        args.w_off = w_offsets_.data();
+        args.w_wei = w_weights_.data();
+
+        if (is_linear) {
+            // the corners are enumerated with h being the innermost
+            const linear_coeffs_t &cd = linear_coeffs_[od];
+            const linear_coeffs_t &ch = linear_coeffs_[OD + oh];
+            const int n_d = ndims == 5 ? 2 : 1;
+            const int n_h = ndims >= 4 ? 2 : 1;
+            for_(int i = 0; i < n_d; i++)
+            for (int j = 0; j < n_h; j++) {
+                args.src[i * n_h + j] = src_sp
+                        + (cd.idx[i] * stride_d_ + ch.idx[j] * stride_h_)
+                                * src_dt_size;
+                args.wei[i * n_h + j] = (n_d == 2 ? cd.wei[i] : 1.f)
+                        * (n_h == 2 ? ch.wei[j] : 1.f);
+            }
+        } else {
+            const dim_t id = nearest_idx(od, pd()->FD());
+            const dim_t ih = nearest_idx(oh, pd()->FH());
+            args.src[0]
+                    = src_sp + (id * stride_d_ + ih * stride_h_) * src_dt_size;
+        }
+
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_resampling_fwd_t<avx2>;
+template struct jit_uni_resampling_fwd_t<sse41>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_RESAMPLING_HPP
+#define CPU_X64_JIT_UNI_RESAMPLING_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_resampling_pd.hpp"
+#include "cpu/resampling_utils.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+template <cpu_isa_t isa>
+struct jit_uni_resampling_kernel_t;
+
+/* Forward resampling for the isa without avx512.
+ *
+ * The kernel computes a whole row of the destination along the w dimension.
+ * The w indices and weights do not depend on the minibatch, channels and
+ * the other spatial dimensions, hence they are precomputed once in a table
+ * that is shared by all the rows. The d and h corners of a row are resolved
+ * by the driver. The channels are vectorized for the channels last and the
+ * blocked layouts, while the plain f32 layouts are vectorized along the w
+ * dimension with the table used as gather indices.
+ *
+ * The s8 and u8 values are converted to f32 on load, the output scale and the
+ * post-ops are applied in f32 and the result is saturated to dst on store. */
+template <cpu_isa_t isa>
+struct jit_uni_resampling_fwd_t : public primitive_t {
+    struct pd_t : public cpu_resampling_fwd_pd_t {
+        using cpu_resampling_fwd_pd_t::cpu_resampling_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_resampling_fwd_t);
+
+        status_t init(engine_t *engine);
+    };
+
+    jit_uni_resampling_fwd_t(const pd_t *apd);
+    ~jit_uni_resampling_fwd_t();
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    void fill_coeffs();
+
+    std::unique_ptr<jit_uni_resampling_kernel_t<isa>> kernel_;
+
+    dim_t nsp_outer_;
+    dim_t stride_d_;
+    dim_t stride_h_;
+    dim_t inner_stride_;
+    // d and h interpolation coefficients
+    std::vector<resampling_utils::linear_coeffs_t> linear_coeffs_;
+    // byte offsets and weights of the w taps, [taps][OW]
+    std::vector<int32_t> w_offsets_;
+    std::vector<float> w_weights_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
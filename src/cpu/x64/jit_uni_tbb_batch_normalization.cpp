@@ -1739,7 +1739,7 @@ status_t jit_uni_tbb_batch_normalization_fwd_t<isa>::pd_t::init(
     bool ok = true && mayiuse(isa) && is_fwd() && !has_zero_dim_memory()
             && one_of(ndims(), 4, 5) && one_of(src_md()->data_type, f32, bf16)
             && IMPLICATION(src_md()->data_type == bf16, mayiuse(avx512_core))
-            && check_scale_shift_data_type()
+            && check_scale_shift_data_type() && !fuse_norm_add_relu()
             && memory_desc_matches_tag(*src_md(), desired_fmt_tag)
             && (attr()->has_default_values() || this->with_relu_post_op());
     if (!ok) return status::unimplemented;
@@ -1815,7 +1815,7 @@ status_t jit_uni_tbb_batch_normalization_bwd_t<isa>::pd_t::init(
                     everyone_is(bf16, src_md()->data_type,
                             diff_src_md()->data_type))
             && IMPLICATION(src_md()->data_type == bf16, mayiuse(avx512_core))
-            && check_scale_shift_data_type()
+            && check_scale_shift_data_type() && !fuse_norm_add_relu()
             && memory_desc_matches_tag(*src_md(), desired_fmt_tag)
             && memory_desc_matches_tag(*diff_src_md(), desired_fmt_tag)
             && attr()->has_default_values();
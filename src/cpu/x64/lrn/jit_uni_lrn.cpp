@@ -189,9 +189,16 @@ jit_uni_lrn_bwd_t<isa>::jit_uni_lrn_bwd_t(const pd_t *apd)
     const int ls = pd()->desc()->local_size;
     float A = pd()->desc()->lrn_alpha / ls;
     float B = pd()->desc()->lrn_beta;
+    auto dat_tag = pd()->dat_tag_;
 
     int use_h_parallelizm = 0; // XXX
-    if (C / VECTOR_LENGTH == 1) {
+    if (dat_tag == nhwc || isa == sse41) {
+        const int c8_stride = dat_tag == nhwc
+                ? VECTOR_LENGTH
+                : H * W * VECTOR_LENGTH;
+        ker_ = new jit_uni_lrn_bwd_kernel_f32<isa>(
+                point_across(C, c8_stride), A, B);
+    } else if (C / VECTOR_LENGTH == 1) {
         ker_ = new jit_uni_lrn_bwd_kernel_f32<isa>(
                 nchw8c_across(H, W, 3), A, B, use_h_parallelizm);
     } else {
@@ -222,9 +229,22 @@ void jit_uni_lrn_bwd_t<isa>::execute_backward(const exec_ctx_t &ctx) const {
     const int C = pd()->C();
     const int H = pd()->H();
     const int W = pd()->W();
+    auto dat_tag = pd()->dat_tag_;
 
     int use_h_parallelizm = 0; // XXX
-    if (use_h_parallelizm) {
+    if (dat_tag == nhwc || isa == sse41) {
+        // the kernel processes all the channels of a single point
+        const int hw_stride = dat_tag == nhwc ? C : VECTOR_LENGTH;
+        parallel_nd(N, H * W, [&](int n, int hw) {
+            auto offset = n * C * H * W + hw * hw_stride;
+            jit_args_bwd_t args;
+            args.src = &src[offset];
+            args.diff_dst = &diff_dst[offset];
+            args.scratch = &ws[offset];
+            args.diff_src = &diff_src[offset];
+            (*ker_)(&args);
+        });
+    } else if (use_h_parallelizm) {
         parallel_nd(N, C / VECTOR_LENGTH, H, [&](int n, int c8, int h) {
             auto offset = n * C * H * W + c8 * H * W * VECTOR_LENGTH
                     + h * W * VECTOR_LENGTH;
@@ -278,16 +298,18 @@ status_t jit_uni_lrn_bwd_t<isa>::pd_t::init(engine_t *engine) {
     ws_md_ = *src_md();
     if (!compare_ws(hint_fwd_pd_)) return unimplemented;
 
-    dat_tag_ = memory_desc_matches_one_of_tag(*src_md(), nChw8c);
+    dat_tag_ = memory_desc_matches_one_of_tag(*src_md(), nChw8c, nhwc);
 
     bool args_ok_across = true && desc()->alg_kind == lrn_across_channels
-            && desc()->local_size == 5 && utils::one_of(dat_tag_, nChw8c);
+            && desc()->local_size == 5 && utils::one_of(dat_tag_, nChw8c, nhwc)
+            && memory_desc_matches_tag(*diff_src_md(), dat_tag_);
 
     return args_ok_across ? success : unimplemented;
 }
 
 template struct jit_uni_lrn_fwd_t<sse41>;
 template struct jit_uni_lrn_fwd_t<avx2>;
+template struct jit_uni_lrn_bwd_t<sse41>;
 template struct jit_uni_lrn_bwd_t<avx2>;
 
 } // namespace x64
@@ -1389,8 +1389,145 @@ jit_uni_lrn_bwd_kernel_f32<isa>::jit_uni_lrn_bwd_kernel_f32(
             const_cast<uint8_t *>(this->getCode()));
 }
 
+template <cpu_isa_t isa>
+jit_uni_lrn_bwd_kernel_f32<isa>::jit_uni_lrn_bwd_kernel_f32(
+        const struct point_across &J, float A, float B, void *code_ptr,
+        size_t code_size)
+    : jit_generator(code_ptr, code_size)
+    , nalphabeta(-2 * A * B)
+    , use_h_parallelizm(0) {
+    using Vmm = typename utils::conditional<isa == avx2, Xbyak::Ymm,
+            Xbyak::Xmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    // a block of 8 channels takes 1 ymm or 2 xmm registers
+    const int c8_size = VECTOR_LENGTH * sizeof(float);
+    const int nregs = c8_size / vlen;
+    const int c8_stride = J.c8_stride * sizeof(float);
+
+    Xbyak::Reg64 t = rsp;
+    Xbyak::Reg64 c = r10;
+
+    Vmm vnalphabeta = Vmm(0);
+    Vmm vsrc = Vmm(1);
+    Vmm vws = Vmm(2);
+    Vmm vpow = Vmm(3);
+    Vmm vsum = Vmm(4);
+    Vmm vtmp = Vmm(5);
+    Vmm vdiffsrc = Vmm(6);
+
+    /* The stack keeps diff_dst * src / ws^1.75 for the previous, current
+     * and next blocks of channels:
+     *  t:  | -- prev -- | -- cur -- | -- next -- |
+     * so that the window of 5 channels around the current block is loaded
+     * with the unaligned loads at t + c8_size + {-8, -4, 0, 4, 8}. The prev
+     * block of the first and the next block of the last one are zero. */
+    auto t_off = [&](int block) { return block * c8_size; };
+
+    // vpow <- ws^0.75
+    auto pow_ws = [&]() {
+        uni_vmovups(vpow, vws);
+        uni_vmulps(vpow, vpow, vws);
+        uni_vmulps(vpow, vpow, vws);
+        uni_vsqrtps(vpow, vpow);
+        uni_vsqrtps(vpow, vpow);
+    };
+
+    auto compute_scaled = [&](int off, int block) {
+        for (int i = 0; i < nregs; ++i) {
+            uni_vmovups(vws, ptr[workspace + off + i * vlen]);
+            pow_ws();
+            uni_vmulps(vpow, vpow, vws); // vpow <- ws^1.75
+            uni_vmovups(vsum, ptr[diffdst + off + i * vlen]);
+            uni_vmovups(vsrc, ptr[src + off + i * vlen]);
+            uni_vmulps(vsum, vsum, vsrc);
+            uni_vdivps(vsum, vsum, vpow);
+            uni_vmovups(ptr[t + t_off(block) + i * vlen], vsum);
+        }
+    };
+
+    auto zero_block = [&](int block) {
+        uni_vxorps(vtmp, vtmp, vtmp);
+        for (int i = 0; i < nregs; ++i)
+            uni_vmovups(ptr[t + t_off(block) + i * vlen], vtmp);
+    };
+
+    auto compute_diff_src = [&]() {
+        for (int i = 0; i < nregs; ++i) {
+            const int off = t_off(1) + i * vlen;
+            uni_vmovups(vsum, ptr[t + off - 8]);
+            for (int s : {-4, 0, 4, 8}) {
+                uni_vmovups(vtmp, ptr[t + off + s]);
+                uni_vaddps(vsum, vsum, vtmp);
+            }
+
+            uni_vmovups(vws, ptr[workspace + i * vlen]);
+            pow_ws();
+            uni_vmovups(vdiffsrc, ptr[diffdst + i * vlen]);
+            uni_vdivps(vdiffsrc, vdiffsrc, vpow);
+
+            uni_vmovups(vsrc, ptr[src + i * vlen]);
+            uni_vmulps(vsrc, vsrc, vnalphabeta);
+            uni_vfmadd231ps(vdiffsrc, vsum, vsrc);
+            uni_vmovups(ptr[diffsrc + i * vlen], vdiffsrc);
+        }
+    };
+
+    auto shift_blocks = [&]() {
+        for (int block = 0; block < 2; ++block)
+            for (int i = 0; i < nregs; ++i) {
+                uni_vmovups(vtmp, ptr[t + t_off(block + 1) + i * vlen]);
+                uni_vmovups(ptr[t + t_off(block) + i * vlen], vtmp);
+            }
+    };
+
+    this->preamble();
+
+    mov(src, ptr[this->param1 + 0]);
+    mov(diffdst, ptr[this->param1 + 8]);
+    mov(workspace, ptr[this->param1 + 16]);
+    mov(diffsrc, ptr[this->param1 + 24]);
+
+    sub(t, 3 * c8_size);
+    mov(imm_addr64, float2int(this->nalphabeta));
+    movq(xnalphabeta, imm_addr64);
+    uni_vbroadcastss(vnalphabeta, xnalphabeta);
+
+    zero_block(0);
+    compute_scaled(0, 1);
+
+    const int nb_c8 = J.C / VECTOR_LENGTH;
+    if (nb_c8 > 1) {
+        mov(c, nb_c8 - 1);
+        Label lrn_loop;
+        L(lrn_loop);
+        {
+            compute_scaled(c8_stride, 2);
+            compute_diff_src();
+            shift_blocks();
+
+            add(src, c8_stride);
+            add(diffdst, c8_stride);
+            add(workspace, c8_stride);
+            add(diffsrc, c8_stride);
+
+            dec(c);
+            jnz(lrn_loop, T_NEAR);
+        }
+    }
+
+    zero_block(2);
+    compute_diff_src();
+
+    add(t, 3 * c8_size);
+    this->postamble();
+
+    ker = reinterpret_cast<decltype(ker)>(
+            const_cast<uint8_t *>(this->getCode()));
+}
+
 template struct jit_uni_lrn_fwd_kernel_f32<sse41>;
 template struct jit_uni_lrn_fwd_kernel_f32<avx2>;
+template struct jit_uni_lrn_bwd_kernel_f32<sse41>;
 template struct jit_uni_lrn_bwd_kernel_f32<avx2>;
 
 } // namespace x64
@@ -65,6 +65,13 @@ struct nhwc_across {
     nhwc_across(int c) : C(c) {}
 };
 
+/* all the channels of a single point, the blocks of 8 channels are
+ * c8_stride floats apart: 8 for nhwc and H * W * 8 for nChw8c */
+struct point_across {
+    int C, c8_stride;
+    point_across(int c, int s) : C(c), c8_stride(s) {}
+};
+
 template <cpu_isa_t isa>
 struct jit_uni_lrn_fwd_kernel_f32 : public jit_generator {
     Xbyak::Reg64 src = rax;
@@ -140,6 +147,9 @@ struct jit_uni_lrn_bwd_kernel_f32 : public jit_generator {
     jit_uni_lrn_bwd_kernel_f32(const struct nchw8c_across &J, float A, float B,
             int use_h_parallel, void *code_ptr = nullptr,
             size_t code_size = 1 * Xbyak::DEFAULT_MAX_CODE_SIZE);
+    jit_uni_lrn_bwd_kernel_f32(const struct point_across &J, float A, float B,
+            void *code_ptr = nullptr,
+            size_t code_size = 1 * Xbyak::DEFAULT_MAX_CODE_SIZE);
 
     void operator()(jit_args_bwd_t *arg) { ker(arg); }
     void (*ker)(jit_args_bwd_t *);
@@ -0,0 +1,185 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "common/convolution_pd.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/wino_conv_cost_model.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace wino_conv_cost_model {
+
+using namespace dnnl::impl::utils;
+
+namespace {
+// vector multiply-add instructions issued per cycle
+const double fma_ports = 2.;
+// fractions of the peak reached by the direct kernels, by the batched
+// products of Winograd and by its transforms, that are mostly additions
+const double direct_efficiency = 0.85;
+const double gemm_efficiency = 0.75;
+const double transform_efficiency = 0.4;
+// bytes per cycle a core gets from L2 and from the memory and LLC shared
+// with the other cores
+const double l2_bandwidth = 32.;
+const double mem_bandwidth = 4.;
+// the smallest number of tiles the Winograd implementations process at
+// once, and the channels the direct ones process at once
+const dim_t tile_block = 16;
+const dim_t oc_block = 16;
+// the transforms and the transformed data use 32-bit values
+const size_t acc_size = sizeof(float);
+
+int vlen(cpu_isa_t isa) {
+    if ((isa & avx512_common_bit) == avx512_common_bit) return 64;
+    if ((isa & avx_bit) == avx_bit) return 32;
+    return 16;
+}
+
+double macs_per_cycle(const conv_shape_t &s, cpu_isa_t isa) {
+    double lanes = (double)vlen(isa) / s.data_size;
+    // int8 needs two instructions for a multiply-add without vnni
+    if (s.data_size == 1 && (isa & avx512_core_vnni_bit) == 0) lanes /= 2;
+    return fma_ports * lanes;
+}
+
+double ops_per_cycle(cpu_isa_t isa) {
+    return fma_ports * vlen(isa) / acc_size;
+}
+
+// the share of the threads that get work when the work items are handed
+// out in rounds of nthr
+double thread_efficiency(double work, int nthr) {
+    if (work <= 0) return 1.;
+    const double rounds = ceil(work / nthr);
+    return work / (rounds * nthr);
+}
+} // namespace
+
+conv_shape_t::conv_shape_t(const convolution_desc_t &cd) {
+    const memory_desc_t &src = *conv_prop_invariant_src_d(&cd);
+    const memory_desc_t &wei = *conv_prop_invariant_wei_d(&cd);
+    const memory_desc_t &dst = *conv_prop_invariant_dst_d(&cd);
+    const int ndims = src.ndims;
+    const bool with_groups = wei.ndims == ndims + 1;
+
+    prop_kind = cd.prop_kind;
+    mb = src.dims[0];
+    ic = src.dims[1];
+    oc = dst.dims[1];
+    ih = ndims >= 4 ? src.dims[ndims - 2] : 1;
+    iw = src.dims[ndims - 1];
+    oh = ndims >= 4 ? dst.dims[ndims - 2] : 1;
+    ow = dst.dims[ndims - 1];
+    kh = ndims >= 4 ? wei.dims[with_groups + ndims - 2] : 1;
+    kw = wei.dims[with_groups + ndims - 1];
+    data_size = types::data_type_size(src.data_type);
+}
+
+double direct_cost(const conv_shape_t &s, cpu_isa_t isa, int nthr) {
+    const double L2 = platform::get_per_core_cache_size(2);
+
+    const double macs = (double)s.mb * s.oh * s.ow * s.oc * s.ic * s.kh * s.kw;
+    const double compute
+            = macs / nthr / (macs_per_cycle(s, isa) * direct_efficiency);
+
+    const double src_bytes = (double)s.mb * s.ih * s.iw * s.ic * s.data_size;
+    const double dst_bytes = (double)s.mb * s.oh * s.ow * s.oc * s.data_size;
+    const double wei_bytes = (double)s.oc * s.ic * s.kh * s.kw * s.data_size;
+    // the source is read again for every part of the weights fitting L2
+    const double src_reads = nstl::max(1., ceil(wei_bytes / L2));
+    const double memory
+            = ((src_bytes * src_reads + dst_bytes) / nthr + wei_bytes)
+            / mem_bandwidth;
+
+    const double work = (double)s.mb * s.oh * div_up(s.oc, oc_block);
+    return nstl::max(compute, memory) / thread_efficiency(work, nthr);
+}
+
+double winograd_cost(const conv_shape_t &s, int m, cpu_isa_t isa, int nthr) {
+    const double L2 = platform::get_per_core_cache_size(2);
+
+    const dim_t alpha_h = m + s.kh - 1;
+    const dim_t alpha_w = m + s.kw - 1;
+    const double alpha_sq = (double)alpha_h * alpha_w;
+    const double tiles = (double)s.mb * div_up(s.oh, m) * div_up(s.ow, m);
+
+    // Every transform is applied to the columns and then to the rows, each
+    // point being a combination of a column or a row of the input.
+    const double src_trans_ops = tiles * s.ic * alpha_sq * (alpha_h + alpha_w);
+    const double dst_trans_ops
+            = tiles * s.oc * m * (alpha_w * alpha_h + m * alpha_w);
+    // the weights are transformed at every execution for training
+    const bool with_wei_trans = s.prop_kind != prop_kind::forward_inference;
+    const double wei_trans_ops = with_wei_trans
+            ? (double)s.ic * s.oc * alpha_h * s.kw * (s.kh + alpha_w)
+            : 0.;
+    const double gemm_macs = alpha_sq * tiles * s.ic * s.oc;
+    const double compute
+            = (gemm_macs / (macs_per_cycle(s, isa) * gemm_efficiency)
+                      + (src_trans_ops + dst_trans_ops + wei_trans_ops)
+                              / (ops_per_cycle(isa) * transform_efficiency))
+            / nthr;
+
+    const double src_bytes = (double)s.mb * s.ih * s.iw * s.ic * s.data_size;
+    const double dst_bytes = (double)s.mb * s.oh * s.ow * s.oc * s.data_size;
+    const double wei_bytes = alpha_sq * s.ic * s.oc * s.data_size;
+    // the transformed weights are read again for every block of tiles when
+    // they do not fit L2
+    const double wei_reads = wei_bytes > L2
+            ? nstl::max(1., ceil(tiles / nthr / tile_block))
+            : 1.;
+    const double wei_trans_bytes = with_wei_trans
+            ? ((double)s.ic * s.oc * s.kh * s.kw * acc_size + wei_bytes)
+            : 0.;
+    // the transformed data is written and read back, from L2 when a block
+    // of tiles fits there
+    const double trans_bytes = 2. * alpha_sq * tiles * (s.ic + s.oc) * acc_size;
+    const bool trans_in_l2
+            = alpha_sq * tile_block * (s.ic + s.oc) * acc_size <= L2;
+    const double memory
+            = ((src_bytes + dst_bytes + wei_trans_bytes) / nthr
+                      + wei_bytes * wei_reads)
+                    / mem_bandwidth
+            + trans_bytes / nthr
+                    / (trans_in_l2 ? l2_bandwidth : mem_bandwidth);
+
+    const double work = ceil(tiles / tile_block);
+    return nstl::max(compute, memory) / thread_efficiency(work, nthr);
+}
+
+bool is_winograd_faster_than_direct(
+        const convolution_desc_t &cd, int m, cpu_isa_t isa, int nthr) {
+    const conv_shape_t s(cd);
+    return winograd_cost(s, m, isa, nthr) < direct_cost(s, isa, nthr);
+}
+
+} // namespace wino_conv_cost_model
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
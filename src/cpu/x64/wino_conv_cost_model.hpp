@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_WINO_CONV_COST_MODEL_HPP
+#define CPU_X64_WINO_CONV_COST_MODEL_HPP
+
+#include "common/c_types_map.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace wino_conv_cost_model {
+
+/* A rough performance model used to resolve convolution_auto between the
+ * direct and the Winograd algorithms.
+ *
+ * Both algorithms are estimated in cycles per thread as the maximum of the
+ * compute time and of the memory time, divided by the share of the threads
+ * that get work. The compute time counts the multiply-adds of the direct
+ * convolution and of the batched Winograd products, and the arithmetic of
+ * the Winograd transforms. The memory time counts the source, destination and
+ * weights traffic, the source rereads of the direct convolution when its
+ * weights do not fit L2, and the round trips of the transformed data of the
+ * Winograd algorithm, which stay in L2 when a block of tiles fits there. */
+
+struct conv_shape_t {
+    conv_shape_t(const convolution_desc_t &cd);
+
+    prop_kind_t prop_kind;
+    dim_t mb, ic, oc, ih, iw, oh, ow, kh, kw;
+    // the size of the source (or the destination) data type
+    size_t data_size;
+};
+
+// Estimated time of the direct convolution in cycles
+double direct_cost(const conv_shape_t &s, cpu_isa_t isa, int nthr);
+
+// Estimated time of the Winograd F(m x m, kh x kw) convolution in cycles
+double winograd_cost(const conv_shape_t &s, int m, cpu_isa_t isa, int nthr);
+
+bool is_winograd_faster_than_direct(
+        const convolution_desc_t &cd, int m, cpu_isa_t isa, int nthr);
+
+} // namespace wino_conv_cost_model
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -46,7 +46,8 @@ struct wino_reorder_t : public primitive_t {
                     && od.format_kind() == format_kind::wino
                     && utils::one_of(od.wino_desc().wino_format,
                             dnnl_wino_wei_aaOIoi, dnnl_wino_wei_aaOio,
-                            dnnl_wino_wei_aaOBiOo, dnnl_wino_wei_OBaaIBOIio)
+                            dnnl_wino_wei_aaOBiOo, dnnl_wino_wei_OBaaIBOIio,
+                            dnnl_wino_wei_aaIO)
                     && (id.matches_tag(utils::pick(id.ndims() - 4,
                                 format_tag::oihw, format_tag::goihw))
                             || id.matches_tag(utils::pick(id.ndims() - 4,
@@ -167,12 +168,20 @@ private:
                 {0.119514472455649f, -0.179271708683473f, 0.26890756302521f},
                 {0.f, 0.f, 1.f}};
 
+        // interpolation points 0, 1, -1, 2, -2 without any extra scaling
+        const float G_4x4_3x3_std[6][3] = {{1.f / 4, 0.f, 0.f},
+                {-1.f / 6, -1.f / 6, -1.f / 6}, {-1.f / 6, 1.f / 6, -1.f / 6},
+                {1.f / 24, 1.f / 12, 1.f / 6}, {1.f / 24, -1.f / 12, 1.f / 6},
+                {0.f, 0.f, 1.f}};
+
         float *__restrict g;
         if (utils::one_of(wino_format_, dnnl_wino_wei_aaOIoi,
                     dnnl_wino_wei_aaOio, dnnl_wino_wei_aaOBiOo))
             g = (float *)G_2x2_3x3;
         else if (wino_format_ == dnnl_wino_wei_OBaaIBOIio)
             g = (float *)G_4x4_3x3;
+        else if (wino_format_ == dnnl_wino_wei_aaIO)
+            g = w_alpha_ == 4 ? (float *)G_2x2_3x3 : (float *)G_4x4_3x3_std;
         else {
             assert(!"Unknown winograd weights target layout");
             return;
@@ -402,6 +411,8 @@ private:
                 reorder_to_aaOIoi(output, tmp_wei);
                 break;
             case dnnl_wino_wei_aaOio: reorder_to_aaOio(output, tmp_wei); break;
+            // aaIO is aaOio with a single block of all the channels
+            case dnnl_wino_wei_aaIO: reorder_to_aaOio(output, tmp_wei); break;
             case dnnl_wino_wei_aaOBiOo:
                 reorder_to_aaOBiOo(output, tmp_wei);
                 break;
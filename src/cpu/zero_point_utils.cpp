@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/zero_point_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace zero_point_utils {
+
+bool conv_zero_points_ok(const primitive_attr_t &attr, data_type_t src_dt) {
+    const auto &zp = attr.zero_points_;
+    if (!(zp.defined() && zp.common()
+                && zp.has_default_values(DNNL_ARG_WEIGHTS)))
+        return false;
+    if (zp.has_default_values(DNNL_ARG_SRC)) return true;
+
+    // the padded area is filled with the zero point in the source data type
+    const int src_zp = *zp.get(DNNL_ARG_SRC);
+    return src_dt == data_type::u8 && 0 <= src_zp && src_zp <= UINT8_MAX;
+}
+
+void compute_src_zp_compensation(const memory_desc_wrapper &weights_d,
+        const int8_t *weights, bool with_groups, int32_t src_zero_point,
+        int32_t *compensation) {
+    const int ndims = weights_d.ndims();
+    const int oc_idx = with_groups ? 1 : 0;
+    const int ic_idx = oc_idx + 1;
+    const dims_t &pdims = weights_d.padded_dims();
+
+    const dim_t G = with_groups ? pdims[0] : 1;
+    const dim_t OC = pdims[oc_idx];
+    const dim_t IC = pdims[ic_idx];
+    dim_t K = 1;
+    for (int d = ic_idx + 1; d < ndims; ++d)
+        K *= pdims[d];
+
+    // the offset in a blocked layout is the sum of the contributions of the
+    // separate dimensions, so that the ones of the reduced dimensions are
+    // computed only once
+    auto dim_off = [&](int d, dim_t v) {
+        dims_t pos = {0};
+        pos[d] = v;
+        return weights_d.off_v(pos) - weights_d.offset0();
+    };
+
+    std::vector<dim_t> ic_off(IC), k_off(K);
+    for (dim_t ic = 0; ic < IC; ++ic)
+        ic_off[ic] = dim_off(ic_idx, ic);
+    for (dim_t k = 0; k < K; ++k) {
+        dim_t off = 0, rem = k;
+        for (int d = ndims - 1; d > ic_idx; --d) {
+            off += dim_off(d, rem % pdims[d]);
+            rem /= pdims[d];
+        }
+        k_off[k] = off;
+    }
+
+    parallel_nd(G, OC, [&](dim_t g, dim_t oc) {
+        const int8_t *w = weights + weights_d.offset0()
+                + (with_groups ? dim_off(0, g) : 0) + dim_off(oc_idx, oc);
+        int32_t acc = 0;
+        for_(dim_t ic = 0; ic < IC; ++ic)
+        for (dim_t k = 0; k < K; ++k)
+            acc += w[ic_off[ic] + k_off[k]];
+        compensation[g * OC + oc] = -src_zero_point * acc;
+    });
+}
+
+} // namespace zero_point_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_ZERO_POINT_UTILS_HPP
+#define CPU_ZERO_POINT_UTILS_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/primitive_attr.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace zero_point_utils {
+
+/* The int8 convolutions with the src zero point compute
+ *
+ *     dst = sum (src - src_zp) * wei = sum src * wei - src_zp * sum wei,
+ *
+ * where the padded area of src is treated as src_zp, so that it does not
+ * contribute to the result. The second term does not depend on src and is
+ * folded into a compensation per output channel, while the padded taps are
+ * computed explicitly with the zero point value in place of the source. */
+
+// Checks that the zero points are the common ones known at the primitive
+// creation time and that the src zero point is an u8 value used with the u8
+// source.
+bool conv_zero_points_ok(const primitive_attr_t &attr, data_type_t src_dt);
+
+// Computes compensation[g * OC + oc] = -src_zp * sum(wei[g][oc][...]) where
+// OC is the padded number of the output channels per group. The weights are
+// expected to be zero padded.
+void compute_src_zp_compensation(const memory_desc_wrapper &weights_d,
+        const int8_t *weights, bool with_groups, int32_t src_zero_point,
+        int32_t *compensation);
+
+} // namespace zero_point_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -54,6 +54,7 @@ struct gen9_batch_normalization_fwd_t : public gpu_primitive_t {
                             || utils::everyone_is(s8, src_data_t, dst_data_t))
                     && IMPLICATION(utils::one_of(src_data_t, s8),
                             !is_training() && stats_is_src())
+                    && !fuse_norm_add_relu()
                     && attr()->has_default_values(attr_skip_mask)
                     && IMPLICATION(!attr()->has_default_values(),
                             attr()->post_ops_.len_ == 1 && with_relu_post_op())
@@ -140,7 +141,7 @@ struct gen9_batch_normalization_bwd_t : public gpu_primitive_t {
                                 diff_src_md()->data_type)
                             || utils::everyone_is(bf16, src_md()->data_type,
                                     diff_src_md()->data_type))
-                    && check_scale_shift_data_type()
+                    && check_scale_shift_data_type() && !fuse_norm_add_relu()
                     && attr()->has_default_values()
                     && compute_engine->mayiuse(
                             compute::device_ext_t::intel_subgroups);
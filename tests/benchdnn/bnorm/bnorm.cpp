@@ -166,6 +166,20 @@ static int prepare_fwd(const prb_t *p, dnn_mem_t &src, dnn_mem_t &mean,
         return prepare_fwd_no_stats(p, src, mean, var, ss);
 }
 
+static int prepare_add(const prb_t *p, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
+    // Multiples of 1/8 are exact in all the supported data types and are
+    // comparable with the normalized values
+    const auto nelems = mem_fp.nelems();
+    dnnl::impl::parallel_nd(nelems, [&](int64_t i) {
+        const float value = ((i * 37) % 17 - 8) / 8.f;
+        mem_fp.set_elem(i, value);
+    });
+
+    SAFE(mem_dt.reorder(mem_fp), WARN);
+
+    return OK;
+}
+
 static int prepare_bwd(const prb_t *p, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
     const auto nelems = mem_fp.nelems();
     if (nelems == 0) return OK;
@@ -209,7 +223,8 @@ static int prepare_bwd(const prb_t *p, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
 }
 
 static int compare(const prb_t *p, data_kind_t kind, const dnn_mem_t &fp_mem,
-        const dnn_mem_t &dt_mem, res_t *r, const dnn_mem_t *ss = nullptr) {
+        const dnn_mem_t &dt_mem, res_t *r, const dnn_mem_t *ss = nullptr,
+        const dnn_mem_t *src_add = nullptr) {
     const char *skind = data_kind2str(kind);
 
     const int f32_mant_digits = 24;
@@ -267,6 +282,17 @@ static int compare(const prb_t *p, data_kind_t kind, const dnn_mem_t &fp_mem,
             }
         }
 
+        /* The second source of the fused add may cancel the normalized
+         * value as well, hence the error is estimated relative to the
+         * largest of the summands. */
+        if (!ok && (p->dir & FLAG_FWD) && kind == DATA && src_add) {
+            const float add = src_add->get_elem(i);
+            const float beta = ss ? ((float *)*ss)[p->ic + c] : 0;
+            const float scale
+                    = MAX2(fabsf(fp), MAX2(fabsf(add), fabsf(beta)));
+            ok = diff / (scale > FLT_MIN ? scale : 1) <= eps;
+        }
+
         r->errors += !ok;
 
         bool dump = false || (!ok && (r->errors < 10 || verbose >= 10))
@@ -513,12 +539,21 @@ int doit(const prb_t *p, res_t *r) {
     dnn_mem_t ws_dt(ws_md, engine_tgt_fwd);
     dnn_mem_t scratchpad_dt(scratchpad_md, engine_tgt_fwd);
 
-    dnn_mem_t d_dst_dt, placeholder_d_src_dt;
+    // the second source of the fused add shares the descriptor with src
+    const bool fuse_add_relu = p->flags & FUSE_ADD_RELU;
+    dnn_mem_t src_add_fp, src_add_dt;
+    if (fuse_add_relu) {
+        src_add_fp = dnn_mem_t(data_md, fp, tag, engine_tgt_fwd);
+        src_add_dt = dnn_mem_t(data_md, engine_tgt_fwd);
+    }
+
+    dnn_mem_t d_dst_dt, placeholder_d_src_dt, d_src_add_dt;
 
     if (prepare_fwd(p, src_fp, mean_fp, var_fp, ss_fp) != OK) {
         DNN_SAFE_V(dnnl_primitive_destroy(b));
         return r->state = MISTRUSTED, OK;
     }
+    if (fuse_add_relu) SAFE(prepare_add(p, src_add_dt, src_add_fp), WARN);
 
     SAFE(src_dt.reorder(src_fp), WARN);
     if (p->flags & GLOB_STATS) {
@@ -535,21 +570,24 @@ int doit(const prb_t *p, res_t *r) {
     args.set(DNNL_ARG_SCALE_SHIFT, ss_dt);
     args.set(DNNL_ARG_WORKSPACE, ws_dt);
     args.set(DNNL_ARG_SCRATCHPAD, scratchpad_dt);
+    if (fuse_add_relu) args.set(DNNL_ARG_SRC_1, src_add_dt);
 
     DNN_SAFE(execute_and_wait(b, engine_tgt_fwd, args), WARN);
 
     // Running ref to collect src_hat (used instead of src + mean) and ws, if
     // fuse_relu flag is requested.
     if (bench_mode & CORR) {
-        compute_ref_fwd(
-                p, src_fp, mean_fp, var_fp, ss_fp, ws_fp, dst_fp, src_hat_fp);
+        compute_ref_fwd(p, src_fp, src_add_fp, mean_fp, var_fp, ss_fp, ws_fp,
+                dst_fp, src_hat_fp);
         if (p->dir & FLAG_FWD) {
             if (!(p->flags & GLOB_STATS) && !(p->dir & FLAG_INF)) {
                 SAFE(compare(p, MEAN, mean_fp, mean_dt, r), WARN);
                 SAFE(compare(p, VAR, var_fp, var_dt, r), WARN);
             }
             dnn_mem_t dst(dst_dt, fp, tag, engine_tgt_fwd);
-            SAFE(compare(p, DATA, dst_fp, dst, r, &ss_fp), WARN);
+            SAFE(compare(p, DATA, dst_fp, dst, r, &ss_fp,
+                         fuse_add_relu ? &src_add_fp : nullptr),
+                    WARN);
             if (p->debug_check_ws) SAFE(check_fwd_ws(dst_dt, ws_dt, r), WARN);
         }
     }
@@ -583,6 +621,12 @@ int doit(const prb_t *p, res_t *r) {
         }
         dnn_mem_t &d_src_dt = p->inplace ? d_dst_dt : placeholder_d_src_dt;
 
+        dnn_mem_t d_src_add_fp;
+        if (fuse_add_relu) {
+            d_src_add_fp = dnn_mem_t(d_data_md, fp, tag, engine_tgt_bwd);
+            d_src_add_dt = dnn_mem_t(d_data_md, engine_tgt_bwd);
+        }
+
         scratchpad_dt = dnn_mem_t(d_scratchpad_md, engine_tgt_bwd);
 
         SAFE(prepare_bwd(p, d_dst_dt, d_dst_fp), WARN);
@@ -597,17 +641,22 @@ int doit(const prb_t *p, res_t *r) {
         args.set(DNNL_ARG_DIFF_SCALE_SHIFT, d_ss_dt);
         args.set(DNNL_ARG_WORKSPACE, ws_dt);
         args.set(DNNL_ARG_SCRATCHPAD, scratchpad_dt);
+        if (fuse_add_relu) args.set(DNNL_ARG_DIFF_SRC_1, d_src_add_dt);
 
         DNN_SAFE(execute_and_wait(b, engine_tgt_bwd, args), WARN);
 
         if (bench_mode & CORR) {
             compute_ref_bwd(p, src_hat_fp, var_fp, d_dst_fp, ss_fp, ws_fp,
-                    d_src_fp, d_ss_fp);
+                    d_src_fp, d_src_add_fp, d_ss_fp);
             if ((p->flags & USE_SCALESHIFT) && (p->dir & FLAG_WEI)) {
                 SAFE(compare(p, SS, d_ss_fp, d_ss_dt, r), WARN);
             }
             dnn_mem_t d_src(d_src_dt, fp, tag, engine_tgt_bwd);
             SAFE(compare(p, DATA, d_src_fp, d_src, r), WARN);
+            if (fuse_add_relu) {
+                dnn_mem_t d_src_add(d_src_add_dt, fp, tag, engine_tgt_bwd);
+                SAFE(compare(p, DATA, d_src_add_fp, d_src_add, r), WARN);
+            }
         }
     }
     const auto &engine_tgt
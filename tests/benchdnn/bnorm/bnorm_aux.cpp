@@ -41,6 +41,8 @@ flags_t str2flags(const char *str) {
         if (*str == 'G') flags |= GLOB_STATS;
         if (*str == 'S') flags |= USE_SCALESHIFT;
         if (*str == 'R') flags |= FUSE_NORM_RELU;
+        if (*str == 'A') flags |= FUSE_ADD_NORM;
+        if (*str == 'D') flags |= FUSE_ADD_RELU;
         str++;
     }
     return flags;
@@ -51,6 +53,8 @@ std::string flags2str(flags_t flags) {
     if (flags & GLOB_STATS) str += "G";
     if (flags & USE_SCALESHIFT) str += "S";
     if (flags & FUSE_NORM_RELU) str += "R";
+    if (flags & FUSE_ADD_NORM) str += "A";
+    if (flags & FUSE_ADD_RELU) str += "D";
     return str;
 }
 
@@ -21,15 +21,17 @@
 namespace bnorm {
 
 void compute_ref_fwd(const prb_t *p, const dnn_mem_t &src,
-        const dnn_mem_t &mean, const dnn_mem_t &var, const dnn_mem_t &ss,
-        dnn_mem_t &ws, dnn_mem_t &dst, dnn_mem_t &src_hat) {
+        const dnn_mem_t &src_add, const dnn_mem_t &mean, const dnn_mem_t &var,
+        const dnn_mem_t &ss, dnn_mem_t &ws, dnn_mem_t &dst,
+        dnn_mem_t &src_hat) {
     const int64_t MB = p->mb;
     const int64_t C = p->ic;
     const int64_t D = p->id;
     const int64_t H = p->ih;
     const int64_t W = p->iw;
     const bool use_scale_shift = p->flags & USE_SCALESHIFT;
-    const bool fuse_relu = p->flags & FUSE_NORM_RELU;
+    const bool fuse_add_relu = p->flags & FUSE_ADD_RELU;
+    const bool fuse_relu = (p->flags & FUSE_NORM_RELU) || fuse_add_relu;
     const bool need_ws = p->need_ws();
 
     const auto dt = p->dt;
@@ -51,6 +53,7 @@ void compute_ref_fwd(const prb_t *p, const dnn_mem_t &src,
             float x_hat = (src.get_elem(off) - smean) * rcp_denom;
             float res = gamma * x_hat + beta;
             float &D = ((float *)dst)[off];
+            if (fuse_add_relu) res += src_add.get_elem(off);
             if (fuse_relu && res < 0) res = 0;
             if (need_ws) ws.set_elem(off, !!res);
             maybe_post_ops(res, D, attr);
@@ -62,7 +65,8 @@ void compute_ref_fwd(const prb_t *p, const dnn_mem_t &src,
 
 void compute_ref_bwd(const prb_t *p, const dnn_mem_t &src_hat,
         const dnn_mem_t &var, const dnn_mem_t &d_dst, const dnn_mem_t &ss,
-        const dnn_mem_t &ws, dnn_mem_t &d_src, dnn_mem_t &d_ss) {
+        const dnn_mem_t &ws, dnn_mem_t &d_src, dnn_mem_t &d_src_add,
+        dnn_mem_t &d_ss) {
     const int64_t MB = p->mb;
     const int64_t C = p->ic;
     const int64_t D = p->id;
@@ -70,7 +74,8 @@ void compute_ref_bwd(const prb_t *p, const dnn_mem_t &src_hat,
     const int64_t W = p->iw;
     const bool glob_stats = p->flags & GLOB_STATS;
     const bool use_scale_shift = p->flags & USE_SCALESHIFT;
-    const bool fuse_relu = p->flags & FUSE_NORM_RELU;
+    const bool fuse_add_relu = p->flags & FUSE_ADD_RELU;
+    const bool fuse_relu = (p->flags & FUSE_NORM_RELU) || fuse_add_relu;
 
     const float MB_SP = MB * D * H * W;
 
@@ -104,6 +109,7 @@ void compute_ref_bwd(const prb_t *p, const dnn_mem_t &src_hat,
             auto off = data_off(p, mb, c, d, h, w);
             float dd = d_dst.get_elem(off);
             if (fuse_relu && ws.get_elem(off) == 0) dd = 0;
+            if (fuse_add_relu) d_src_add.set_elem(off, dd);
             float ds = dd;
 
             if (!glob_stats)
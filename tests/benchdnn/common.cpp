@@ -18,6 +18,7 @@
 #include <limits.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <fstream>
 #include <functional>
 #include <string>
@@ -93,6 +94,10 @@ unsigned long long ticks_now() {
 #endif
 
 void benchdnn_timer_t::reset() {
+    samples_.clear();
+    n_samples_ = 0;
+    rng_.seed();
+
     times_ = 0;
     for (int i = 0; i < n_modes; ++i)
         ticks_[i] = 0;
@@ -134,9 +139,41 @@ void benchdnn_timer_t::stop(int add_times) {
     ticks_[benchdnn_timer_t::max]
             = times_ ? MAX2(ticks_[benchdnn_timer_t::max], d_ticks) : d_ticks;
 
+    add_sample(d_ms, d_ticks);
+
     times_ += add_times;
 }
 
+void benchdnn_timer_t::add_sample(double ms, long long ticks) {
+    const long long n = n_samples_++;
+    if (n < max_samples) {
+        samples_.push_back({ms, ticks});
+        return;
+    }
+
+    const long long idx = std::uniform_int_distribution<long long>(0, n)(rng_);
+    if (idx < max_samples) samples_[idx] = {ms, ticks};
+}
+
+benchdnn_timer_t::sample_t benchdnn_timer_t::percentile(mode_t mode) const {
+    if (samples_.empty()) return {0, 0};
+
+    const int p = mode == p50 ? 50 : mode == p90 ? 90 : 99;
+    // nearest-rank method
+    const size_t n = samples_.size();
+    const size_t rank = (size_t)MAX2(1, div_up((int64_t)(p * n), 100));
+
+    std::vector<double> ms(n);
+    std::vector<long long> ticks(n);
+    for (size_t i = 0; i < n; ++i) {
+        ms[i] = samples_[i].ms;
+        ticks[i] = samples_[i].ticks;
+    }
+    std::nth_element(ms.begin(), ms.begin() + rank - 1, ms.end());
+    std::nth_element(ticks.begin(), ticks.begin() + rank - 1, ticks.end());
+    return {ms[rank - 1], ticks[rank - 1]};
+}
+
 benchdnn_timer_t &benchdnn_timer_t::operator=(const benchdnn_timer_t &rhs) {
     if (this == &rhs) return *this;
     times_ = rhs.times_;
@@ -146,6 +183,9 @@ benchdnn_timer_t &benchdnn_timer_t::operator=(const benchdnn_timer_t &rhs) {
     for (int i = 0; i < n_modes; ++i)
         ms_[i] = rhs.ms_[i];
     ms_start_ = rhs.ms_start_;
+    samples_ = rhs.samples_;
+    n_samples_ = rhs.n_samples_;
+    rng_ = rhs.rng_;
     return *this;
 }
 
@@ -27,6 +27,7 @@
 
 #include <cinttypes>
 #include <functional>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -130,11 +131,13 @@ extern const char *driver_name;
 extern double max_ms_per_prb; /** maximum time spends per prb in ms */
 extern int min_times_per_prb; /** minimal amount of runs per prb */
 extern int fix_times_per_prb; /** if non-zero run prb that many times */
+extern int warmup_times_per_prb; /** untimed runs before the measurements */
+extern bool cold_cache; /** if true thrash the caches before each run */
 
 extern bool fast_ref_gpu;
 
 struct benchdnn_timer_t {
-    enum mode_t { min = 0, avg = 1, max = 2, n_modes };
+    enum mode_t { min = 0, avg = 1, max = 2, p50, p90, p99, n_modes };
 
     benchdnn_timer_t() { reset(); }
 
@@ -151,6 +154,7 @@ struct benchdnn_timer_t {
 
     double ms(mode_t mode = min) const {
         if (!times()) return 0; // nothing to report
+        if (is_percentile(mode)) return percentile(mode).ms;
         return ms_[mode] / (mode == avg ? times() : 1);
     }
 
@@ -158,14 +162,36 @@ struct benchdnn_timer_t {
 
     long long ticks(mode_t mode = min) const {
         if (!times()) return 0; // nothing to report
+        if (is_percentile(mode)) return percentile(mode).ticks;
         return ticks_[mode] / (mode == avg ? times() : 1);
     }
 
+    static bool is_percentile(mode_t mode) {
+        return mode == p50 || mode == p90 || mode == p99;
+    }
+
     benchdnn_timer_t &operator=(const benchdnn_timer_t &rhs);
 
     int times_;
     long long ticks_[n_modes], ticks_start_;
     double ms_[n_modes], ms_start_;
+
+private:
+    /* A sample is the time of a single run, or the average time of a batch of
+     * runs. Past max_samples the samples are kept with reservoir sampling,
+     * so that the percentiles of long runs are estimated in bounded memory. */
+    struct sample_t {
+        double ms;
+        long long ticks;
+    };
+    enum { max_samples = 1 << 16 };
+
+    void add_sample(double ms, long long ticks);
+    sample_t percentile(mode_t mode) const;
+
+    std::vector<sample_t> samples_;
+    long long n_samples_;
+    std::minstd_rand rng_;
 };
 
 /* global stats */
@@ -198,6 +224,11 @@ struct res_t {
     size_t errors, total;
     benchdnn_timer_t timer;
     std::string impl_name;
+    // primitive creation time in ms: the first one and the one expected to
+    // hit the primitive cache
+    double create_ms, create_cache_hit_ms;
+    // memory footprint of the primitive in bytes
+    size_t scratchpad_size, workspace_size, weights_size;
 };
 
 void parse_result(res_t &res, bool &want_perf_report, bool allow_unimpl,
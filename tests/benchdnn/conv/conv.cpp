@@ -649,6 +649,12 @@ int doit(const prb_t *p, res_t *r) {
     SAFE(fill_bia(engine_tgt, p, bia_dt, bia_fp, r), WARN);
     maybe_prepare_runtime_scales(scales, p->attr, p->oc, p->scales, engine_tgt);
 
+    dnn_mem_t src_zero_points_m, dst_zero_points_m;
+    maybe_prepare_runtime_zero_points(
+            src_zero_points_m, p->attr, DNNL_ARG_SRC, engine_tgt);
+    maybe_prepare_runtime_zero_points(
+            dst_zero_points_m, p->attr, DNNL_ARG_DST, engine_tgt);
+
     args_t args;
 
     if (p->dir & FLAG_FWD) {
@@ -658,6 +664,8 @@ int doit(const prb_t *p, res_t *r) {
         args.set(DNNL_ARG_DST, dst_dt);
         args.set(DNNL_ARG_SCRATCHPAD, scratchpad_dt);
         args.set(DNNL_ARG_ATTR_OUTPUT_SCALES, scales);
+        args.set(DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC, src_zero_points_m);
+        args.set(DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_DST, dst_zero_points_m);
 
         DNN_SAFE(execute_and_wait(c, engine_tgt, args), WARN);
 
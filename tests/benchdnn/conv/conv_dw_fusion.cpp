@@ -89,12 +89,17 @@ dnnl_primitive_attr_t create_dnnl_fusion_attr(
                 const auto bia_dt
                         = p->dir == FWD_B ? dnnl_f32 : dnnl_data_type_undef;
 
-                if (e.convolution.stride == 1) {
+                const auto &c = e.convolution;
+                if (e.kind == attr_t::post_ops_t::kind_t::DW_K3S1P1) {
                     DNN_SAFE_V(dnnl_post_ops_append_dw_k3s1p1(ops, wei_dt,
-                            bia_dt, e.convolution.dst_dt, count, mask, scales));
-                } else {
+                            bia_dt, c.dst_dt, count, mask, scales));
+                } else if (e.kind == attr_t::post_ops_t::kind_t::DW_K3S2P1) {
                     DNN_SAFE_V(dnnl_post_ops_append_dw_k3s2p1(ops, wei_dt,
-                            bia_dt, e.convolution.dst_dt, count, mask, scales));
+                            bia_dt, c.dst_dt, count, mask, scales));
+                } else {
+                    DNN_SAFE_V(dnnl_post_ops_append_dw(ops, wei_dt, bia_dt,
+                            c.dst_dt, c.kernel, c.stride, c.padding, count,
+                            mask, scales));
                 }
                 if (gen_scs) zfree(gen_scs);
             } else if (e.is_eltwise_kind()) {
@@ -294,7 +299,12 @@ std::unique_ptr<prb_t> get_fused_conv_prb(const prb_t *p) {
         dw_cfg_ss << p->cfg[DST].dt << p->cfg[WEI].dt << fused_conv_po.dst_dt;
     auto p_dw_cfg = conv::str2cfg(dw_cfg_ss.str().c_str());
 
-    auto stride = fused_conv_po.stride;
+    const auto kernel = fused_conv_po.kernel;
+    const auto stride = fused_conv_po.stride;
+    const auto padding = fused_conv_po.padding;
+    auto out_size = [&](int64_t i) {
+        return (i + 2 * padding - kernel) / stride + 1;
+    };
     bool is_3d = p->ndims >= 5;
     bool is_2d = p->ndims >= 4;
 
@@ -306,18 +316,18 @@ std::unique_ptr<prb_t> get_fused_conv_prb(const prb_t *p) {
     cd.ih = is_2d ? p->oh : 1;
     cd.iw = p->ow;
     cd.oc = p->oc;
-    cd.od = is_3d ? div_up(cd.id, stride) : 1;
-    cd.oh = is_2d ? div_up(cd.ih, stride) : 1;
-    cd.ow = div_up(cd.iw, stride);
-    cd.kd = is_3d ? 3 : 1;
-    cd.kh = is_2d ? 3 : 1;
-    cd.kw = 3;
+    cd.od = is_3d ? out_size(cd.id) : 1;
+    cd.oh = is_2d ? out_size(cd.ih) : 1;
+    cd.ow = out_size(cd.iw);
+    cd.kd = is_3d ? kernel : 1;
+    cd.kh = is_2d ? kernel : 1;
+    cd.kw = kernel;
     cd.sd = is_3d ? stride : 1;
     cd.sh = is_2d ? stride : 1;
     cd.sw = stride;
-    cd.pd = is_3d;
-    cd.ph = is_2d;
-    cd.pw = 1;
+    cd.pd = is_3d ? padding : 0;
+    cd.ph = is_2d ? padding : 0;
+    cd.pw = padding;
     cd.has_groups = true;
     cd.ndims = p->ndims;
 
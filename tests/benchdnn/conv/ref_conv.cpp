@@ -130,6 +130,9 @@ void compute_ref_direct_fwd(const prb_t *p, dnn_mem_t &src_m, dnn_mem_t &wei_m,
     const int64_t DH = p->dh + 1;
     const int64_t DW = p->dw + 1;
 
+    const int src_zero_point = p->attr.zero_points[DNNL_ARG_SRC];
+    const int dst_zero_point = p->attr.zero_points[DNNL_ARG_DST];
+
     auto ker = [&](float &d, int64_t g, int64_t mb, int64_t oc, int64_t od,
                        int64_t oh, int64_t ow) {
         const float *__restrict src_loc
@@ -149,7 +152,8 @@ void compute_ref_direct_fwd(const prb_t *p, dnn_mem_t &src_m, dnn_mem_t &wei_m,
                     for (int64_t ic = 0; ic < ICG; ++ic) {
                         int64_t src_off = ((ic * ID + id) * IH + ih) * IW + iw;
                         int64_t wei_off = ((ic * KD + kd) * KH + kh) * KW + kw;
-                        d += src_loc[src_off] * wei_loc[wei_off];
+                        d += (src_loc[src_off] - src_zero_point)
+                                * wei_loc[wei_off];
                     }
                 }
             }
@@ -172,6 +176,7 @@ void compute_ref_direct_fwd(const prb_t *p, dnn_mem_t &src_m, dnn_mem_t &wei_m,
 
                 maybe_scale(conv_res, p->scales, g * OCG + oc, p->attr);
                 maybe_post_ops(conv_res, dst, p->attr);
+                conv_res += dst_zero_point;
 
                 dst = conv_res;
             });
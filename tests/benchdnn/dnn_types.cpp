@@ -17,6 +17,7 @@
 #include <assert.h>
 #include <math.h>
 #include <stddef.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -294,6 +295,7 @@ static po_table_entry_t kind_table[] = {
         // sum
         {pk_t::SUM, "sum", dnnl_alg_kind_undef},
         // depthwise convolution
+        {pk_t::DW, "dw", dnnl_convolution_auto},
         {pk_t::DW_K3S1P1, "dw_k3s1p1", dnnl_convolution_auto},
         {pk_t::DW_K3S2P1, "dw_k3s2p1", dnnl_convolution_auto},
         // eltwise
@@ -395,7 +397,20 @@ int attr_t::post_ops_t::from_str(const char *str, const char **end_s) {
                     }
                 } else if (e.is_convolution_kind()) {
                     e.convolution.dst_dt = dnnl_f32;
-                    e.convolution.stride = k == DW_K3S1P1 ? 1 : 2;
+                    e.convolution.kernel = 3;
+                    e.convolution.stride = k == DW_K3S2P1 ? 2 : 1;
+                    e.convolution.padding = 1;
+                    if (k == DW) {
+                        // dw:kXsYpZ[:dst_dt[:policy:scale]]
+                        if (*s != ':') return FAIL;
+                        auto &c = e.convolution;
+                        int n = 0;
+                        if (sscanf(++s, "k%ds%dp%d%n", &c.kernel, &c.stride,
+                                    &c.padding, &n)
+                                != 3)
+                            return FAIL;
+                        s += n;
+                    }
                     e.convolution.oscale = attr_t::scale_t();
                     if (*s == ':') ++s;
                     auto *end = s;
@@ -472,7 +487,8 @@ int attr_t::post_ops_t::eltwise_index() const {
 }
 
 bool attr_t::post_ops_t::entry_t::is_convolution_kind() const {
-    return kind == pk_t::DW_K3S1P1 || kind == pk_t::DW_K3S2P1;
+    return kind == pk_t::DW || kind == pk_t::DW_K3S1P1
+            || kind == pk_t::DW_K3S2P1;
 }
 
 int attr_t::post_ops_t::convolution_index() const {
@@ -582,6 +598,9 @@ std::ostream &operator<<(std::ostream &s, const attr_t::post_ops_t &post_ops) {
         if (e.kind == pk_t::SUM) {
             if (e.sum.scale != 1.0f) s << ":" << e.sum.scale;
         } else if (e.is_convolution_kind()) {
+            if (e.kind == pk_t::DW)
+                s << ":k" << e.convolution.kernel << "s" << e.convolution.stride
+                  << "p" << e.convolution.padding;
             if (e.convolution.dst_dt != dnnl_f32)
                 s << ":" << e.convolution.dst_dt;
             const auto &co = e.convolution.oscale;
@@ -620,6 +639,8 @@ std::ostream &dump_global_params(std::ostream &s) {
         s << "--engine=" << engine_kind2str(engine_tgt_kind) << " ";
     if (canonical || scratchpad_mode != dnnl_scratchpad_mode_library)
         s << "--scratchpad=" << scratchpad_mode2str(scratchpad_mode) << " ";
+    if (canonical || !mem_placement.is_def())
+        s << "--mem-placement=" << mem_placement << " ";
 
     s << "--" << driver_name << " ";
     return s;
@@ -649,6 +670,48 @@ dnnl_scratchpad_mode_t str2scratchpad_mode(const char *str) {
     return dnnl_scratchpad_mode_library;
 }
 
+mem_placement_t str2mem_placement(const char *str) {
+    mem_placement_t placement;
+    const std::string s(str);
+    size_t start_pos = 0;
+    while (start_pos != std::string::npos) {
+        const size_t end_pos = s.find('+', start_pos);
+        const std::string flag = s.substr(start_pos,
+                end_pos == std::string::npos ? end_pos : end_pos - start_pos);
+        start_pos = end_pos == std::string::npos ? end_pos : end_pos + 1;
+
+        const std::string numa_node = "numa_node:";
+        if (flag == "default")
+            placement.flags = dnnl_cpu_memory_placement_default;
+        else if (flag == "huge_pages")
+            placement.flags |= dnnl_cpu_memory_placement_huge_pages;
+        else if (flag == "numa_interleave")
+            placement.flags |= dnnl_cpu_memory_placement_numa_interleave;
+        else if (flag.compare(0, numa_node.size(), numa_node) == 0) {
+            placement.flags |= dnnl_cpu_memory_placement_numa_bind;
+            placement.numa_node = atoi(flag.c_str() + numa_node.size());
+        } else {
+            fprintf(stderr, "ERROR: unknown memory placement: `%s`\n",
+                    flag.c_str());
+            exit(2);
+        }
+    }
+    return placement;
+}
+
+std::ostream &operator<<(std::ostream &s, const mem_placement_t &placement) {
+    if (placement.is_def()) return s << "default";
+
+    const char *delim = "";
+    if (placement.flags & dnnl_cpu_memory_placement_huge_pages)
+        s << delim << "huge_pages", delim = "+";
+    if (placement.flags & dnnl_cpu_memory_placement_numa_interleave)
+        s << delim << "numa_interleave", delim = "+";
+    if (placement.flags & dnnl_cpu_memory_placement_numa_bind)
+        s << delim << "numa_node:" << placement.numa_node;
+    return s;
+}
+
 void attr_bundle_t::init_zero_points() {
     for (const auto &arg_entry : attr.zero_points)
         zero_points[arg_entry.first] = {arg_entry.second.value};
@@ -944,6 +1007,10 @@ void maybe_post_ops(float &d, float dst, const attr_t &attr) {
 
 void engine_t::create_engine(dnnl_engine_kind_t engine_kind) {
     DNN_SAFE_V(dnnl_engine_create(&engine_, engine_kind, 0));
+    if (engine_kind == dnnl_cpu && !mem_placement.is_def()) {
+        DNN_SAFE_V(dnnl_engine_set_cpu_memory_placement(
+                engine_, mem_placement.flags, mem_placement.numa_node));
+    }
 }
 
 void engine_t::destroy_engine() {
@@ -160,6 +160,7 @@ struct attr_t {
             // sum
             SUM,
             // depthwise convolution
+            DW,
             DW_K3S1P1,
             DW_K3S2P1,
             // eltwise
@@ -206,7 +207,7 @@ struct attr_t {
                     float scale, alpha, beta;
                 } eltwise;
                 struct {
-                    int stride;
+                    int kernel, stride, padding;
                     dnnl_data_type_t dst_dt;
                     scale_t oscale;
                 } convolution;
@@ -350,6 +351,15 @@ inline dnnl_primitive_attr_t create_dnnl_attr(const attr_t &attr) {
 dnnl_engine_kind_t str2engine_kind(const char *str);
 dnnl_scratchpad_mode_t str2scratchpad_mode(const char *str);
 
+struct mem_placement_t {
+    unsigned flags = dnnl_cpu_memory_placement_default;
+    int numa_node = 0;
+
+    bool is_def() const { return flags == dnnl_cpu_memory_placement_default; }
+};
+mem_placement_t str2mem_placement(const char *str);
+std::ostream &operator<<(std::ostream &s, const mem_placement_t &placement);
+
 void maybe_scale(float &d, float *scales, int64_t oc, const attr_t &attr);
 float compute_eltwise_fwd(attr_t::post_ops_t::kind_t kind, float src,
         float scale, float alpha, float beta);
@@ -15,8 +15,15 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <math.h>
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
 #include "dnnl.h"
 
+#include "tests/test_thread.hpp"
+
 #include "dnnl_common.hpp"
 #include "dnnl_memory.hpp"
 
@@ -34,12 +41,28 @@ float round_to_nearest_representable(dnnl_data_type_t dt, float value) {
     return value;
 }
 
+float quantize_dynamically(
+        const float *src, int64_t len, int64_t stride, float *dst) {
+    float max_abs = 0.f;
+    for (int64_t i = 0; i < len; ++i)
+        max_abs = MAX2(max_abs, fabsf(src[i * stride]));
+
+    const float inv_scale = max_abs > 0.f ? 127.f / max_abs : 0.f;
+    for (int64_t i = 0; i < len; ++i)
+        dst[i] = saturate<dnnl_s8>(src[i * stride] * inv_scale);
+
+    return max_abs / 127.f;
+}
+
 // Engine kind used to run oneDNN primitives for testing
 dnnl_engine_kind_t engine_tgt_kind = dnnl_cpu;
 
 // Scratchpad mode for oneDNN
 dnnl_scratchpad_mode_t scratchpad_mode = dnnl_scratchpad_mode_library;
 
+// Placement of the large CPU buffers allocated by oneDNN
+mem_placement_t mem_placement;
+
 args_t &args_t::set(int arg, const dnn_mem_t &mem) {
     args_.push_back(std::make_pair(arg, &mem));
     return *this;
@@ -87,10 +110,50 @@ inline bool should_stop(const benchdnn_timer_t &t) {
     return stop;
 }
 
+// Evicts the data used by the previous run from the caches by writing a buffer
+// a few times larger than the last level cache. Every thread writes its own
+// part of the buffer to evict the private caches of the cores as well.
+static void thrash_cache() {
+    static const size_t size = [] {
+        long llc_size = 0;
+#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE)
+        llc_size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+        if (llc_size <= 0) llc_size = 32 * 1024 * 1024;
+        return 4 * (size_t)llc_size;
+    }();
+    static std::vector<char> buf(size);
+
+    const int64_t chunk = 4096;
+    dnnl::impl::parallel_nd(div_up((int64_t)size, chunk), [&](int64_t i) {
+        const int64_t start = i * chunk;
+        const int64_t len = MIN2(chunk, (int64_t)size - start);
+        memset(buf.data() + start, (int)i, len);
+    });
+}
+
+static int warm_up(dnnl_stream_t stream, dnnl_primitive_t prim,
+        std::vector<dnnl_exec_arg_t> &dnnl_args) {
+    for (int i = 0; i < warmup_times_per_prb; i++) {
+        DNN_SAFE(dnnl_primitive_execute(
+                         prim, stream, (int)dnnl_args.size(), dnnl_args.data()),
+                WARN);
+    }
+    DNN_SAFE(dnnl_stream_wait(stream), WARN);
+    return OK;
+}
+
 inline int measure_perf_individual(benchdnn_timer_t &t, dnnl_stream_t stream,
         dnnl_primitive_t prim, std::vector<dnnl_exec_arg_t> &dnnl_args) {
+    SAFE(warm_up(stream, prim, dnnl_args), WARN);
+
     t.reset();
     while (true) {
+        if (cold_cache) {
+            // The thrashing is not a part of the measurement
+            thrash_cache();
+            t.start();
+        }
         DNN_SAFE(dnnl_primitive_execute(
                          prim, stream, (int)dnnl_args.size(), dnnl_args.data()),
                 WARN);
@@ -104,6 +167,8 @@ inline int measure_perf_aggregate(benchdnn_timer_t &t, dnnl_stream_t stream,
         dnnl_primitive_t prim, std::vector<dnnl_exec_arg_t> &dnnl_args) {
     const int max_batch_times = 10000;
 
+    SAFE(warm_up(stream, prim, dnnl_args), WARN);
+
     // Warm-up run
     t.reset();
     DNN_SAFE(dnnl_primitive_execute(
@@ -165,6 +230,26 @@ int measure_perf(benchdnn_timer_t &t, dnnl_engine_t engine,
     return ret;
 }
 
+void query_memory_footprint(const_dnnl_primitive_desc_t pd, res_t *r) {
+    auto md_size = [&](dnnl_query_t what) -> size_t {
+        const dnnl_memory_desc_t *md
+                = dnnl_primitive_desc_query_md(pd, what, 0);
+        return md ? dnnl_memory_desc_get_size(md) : 0;
+    };
+
+    // the library reports the size of the scratchpad it manages only
+    if (scratchpad_mode == dnnl_scratchpad_mode_user) {
+        r->scratchpad_size = md_size(dnnl_query_scratchpad_md);
+    } else {
+        int64_t size = 0;
+        dnnl_primitive_desc_query(
+                pd, dnnl_query_memory_consumption_s64, 0, &size);
+        r->scratchpad_size = (size_t)size;
+    }
+    r->workspace_size = md_size(dnnl_query_workspace_md);
+    r->weights_size = md_size(dnnl_query_weights_md);
+}
+
 void maybe_prepare_runtime_scales(dnn_mem_t &scales_m, const attr_t &attr,
         int64_t scale_cnt, const float *scales, dnnl_engine_t engine) {
     if (!attr.oscale.runtime) return;
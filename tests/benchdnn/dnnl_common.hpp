@@ -184,9 +184,17 @@ inline float maybe_saturate(dnnl_data_type_t dt, float value) {
 
 float round_to_nearest_representable(dnnl_data_type_t dt, float value);
 
+// Quantizes `len` values of `src` taken with `stride` to s8 with the scale
+// max|src| / 127, the way the int8 primitives quantize an f32 source
+// dynamically. The quantized values are written to `dst` as f32. Returns the
+// scale that dequantizes them.
+float quantize_dynamically(
+        const float *src, int64_t len, int64_t stride, float *dst);
+
 /* simplification */
 extern dnnl_engine_kind_t engine_tgt_kind;
 extern dnnl_scratchpad_mode_t scratchpad_mode;
+extern mem_placement_t mem_placement;
 
 inline const char *query_impl_info(const_dnnl_primitive_desc_t pd) {
     const char *str;
@@ -194,6 +202,9 @@ inline const char *query_impl_info(const_dnnl_primitive_desc_t pd) {
     return str;
 }
 
+// saves the sizes of the scratchpad, workspace and weights of `pd` to `r`
+void query_memory_footprint(const_dnnl_primitive_desc_t pd, res_t *r);
+
 struct dnn_mem_t;
 struct attr_bundle_t;
 
@@ -224,11 +235,17 @@ int init_prim(dnnl_primitive_t *prim, const func_t &init_pd_func,
     auto cleanup_pd = [&]() { dnnl_primitive_desc_destroy(_pd); };
     auto cleanup_prim = [&]() { dnnl_primitive_destroy(_prim); };
 
+    // the creation time covers both the implementation search and the
+    // primitive creation (e.g. jit code generation)
+    benchdnn_timer_t create_timer;
+    create_timer.start();
     int status = init_pd_func(engine, p, _pd, r, dir, hint);
     if (status != OK) return status;
     if (r->state == SKIPPED || r->state == UNIMPLEMENTED) return OK;
 
     DNN_SAFE_CLEAN(dnnl_primitive_create(&_prim, _pd), WARN, cleanup_pd);
+    create_timer.stop();
+    r->create_ms = create_timer.ms();
 
 #ifndef DNNL_DISABLE_PRIMITIVE_CACHE
     // The idea is to create the requested primitive twice for different engines.
@@ -250,14 +267,19 @@ int init_prim(dnnl_primitive_t *prim, const func_t &init_pd_func,
 
     // create 2nd engine
     engine.reset(engine_tgt_kind);
+    create_timer.reset();
+    create_timer.start();
     status = init_pd_func(engine, p, _pd, r, dir, hint);
     if (status != OK) return status;
 
     // this primitive comes from the cache
     DNN_SAFE_CLEAN(dnnl_primitive_create(&_prim, _pd), WARN, cleanup_pd);
+    create_timer.stop();
+    r->create_cache_hit_ms = create_timer.ms();
     // XXX: maybe check if the primitive didn't come from the cache and
     // return FAIL in that case?
 #endif
+    query_memory_footprint(_pd, r);
     DNN_SAFE_CLEAN(dnnl_primitive_desc_destroy(_pd), WARN, cleanup_prim);
     (*prim) = _prim;
     return OK;
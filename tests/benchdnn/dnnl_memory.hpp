@@ -213,8 +213,10 @@ private:
         DNN_SAFE_V(dnnl_engine_get_kind(engine_, &engine_kind_));
 
         size_t sz = dnnl_memory_desc_get_size(&md_);
-        if (engine_kind_ == dnnl_cpu && handle == DNNL_MEMORY_ALLOCATE) {
-            // Allocate memory for native runtime directly
+        if (engine_kind_ == dnnl_cpu && handle == DNNL_MEMORY_ALLOCATE
+                && mem_placement.is_def()) {
+            // Allocate memory for native runtime directly, unless the library
+            // is asked to place the buffers
             is_data_owner_ = true;
             const size_t alignment = 2 * 1024 * 1024;
             data_ = zmalloc(sz, alignment);
@@ -168,6 +168,14 @@ const _dt_conf_t conf_s8s8u8 = {
         {dnnl_s32},
 };
 
+const _dt_conf_t conf_f32s8f32 = {
+        {dnnl_f32, -int_max_exact, int_max_exact, -32, 32, 0, .35, 1, 0.},
+        {dnnl_s8, INT8_MIN, INT8_MAX, -5, 5, 0, .35, 1, 0.},
+        {dnnl_f32, -int_max_exact, int_max_exact, -8, 32, 0, .35, 1, 0.},
+        {dnnl_f32, -int_max_exact, int_max_exact, -255, 255, 0, .35, 1, 1e-6},
+        {dnnl_s32},
+};
+
 const dt_conf_t *str2cfg(const char *str) {
 #define CASE(cfg) \
     if (!strcasecmp(STRINGIFY(cfg), str)) return CONCAT2(conf_, cfg)
@@ -181,6 +189,7 @@ const dt_conf_t *str2cfg(const char *str) {
     CASE(s8s8s32);
     CASE(s8s8s8);
     CASE(s8s8u8);
+    CASE(f32s8f32);
     CASE(bf16bf16f32);
     CASE(bf16bf16bf16);
     CASE(f32bf16bf16);
@@ -206,6 +215,7 @@ std::ostream &operator<<(std::ostream &s, const dt_conf_t *cfg) {
     CASE(s8s8s32);
     CASE(s8s8s8);
     CASE(s8s8u8);
+    CASE(f32s8f32);
     CASE(bf16bf16f32);
     CASE(bf16bf16bf16);
     CASE(f32bf16bf16);
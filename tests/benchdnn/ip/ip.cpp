@@ -342,6 +342,9 @@ int doit(const prb_t *p, res_t *r) {
     SAFE(fill_bia(engine_tgt, p, bia_dt, bia_fp, r), WARN);
     SAFE(fill_dst(engine_tgt, p, dst_dt, dst_fp, r), WARN);
 
+    dnn_mem_t scales;
+    maybe_prepare_runtime_scales(scales, p->attr, p->oc, p->scales, engine_tgt);
+
     args_t args;
 
     if (p->dir & FLAG_FWD) {
@@ -350,6 +353,7 @@ int doit(const prb_t *p, res_t *r) {
         args.set(DNNL_ARG_BIAS, bia_dt);
         args.set(DNNL_ARG_DST, dst_dt);
         args.set(DNNL_ARG_SCRATCHPAD, scratchpad_dt);
+        args.set(DNNL_ARG_ATTR_OUTPUT_SCALES, scales);
 
         DNN_SAFE(execute_and_wait(ip, engine_tgt, args), WARN);
 
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -28,7 +29,16 @@
 namespace ip {
 
 void prb_t::generate_oscales() {
-    if (attr.oscale.policy != attr_t::scale_t::policy_t::PER_OC) return;
+    if (attr.oscale.is_def()) return;
+
+    if (attr.oscale.policy == attr_t::scale_t::policy_t::COMMON) {
+        scales = (float *)zmalloc(sizeof(float), 4);
+        SAFE_V(scales != NULL ? OK : FAIL);
+        scales[0] = attr.oscale.scale;
+        return;
+    }
+
+    assert(attr.oscale.policy == attr_t::scale_t::policy_t::PER_OC);
 
     scales = (float *)zmalloc(sizeof(float) * oc, 64);
     SAFE_V(scales != NULL ? OK : FAIL);
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <vector>
+
 #include "tests/test_thread.hpp"
 
 #include "ip/ip.hpp"
@@ -30,7 +32,23 @@ void compute_ref_fwd(const engine_t &engine_tgt, const prb_t *p,
 
     dnn_mem_t dst_tmp(dst_m.md_, dnnl_f32, dnnl_nc, engine_tgt);
 
-    gemm("C", "N", "T", M, N, K, 1.f, (float *)src_m, K, (float *)wei_m, K, 0.f,
+    // f32 source with s8 weights is quantized with a scale per minibatch
+    // sample and the results are dequantized with it
+    const bool dyn_quant
+            = p->cfg[SRC].dt == dnnl_f32 && p->cfg[WEI].dt == dnnl_s8;
+    std::vector<float> src_q, src_scales;
+    float *src = (float *)src_m;
+    if (dyn_quant) {
+        src_q.resize(M * K);
+        src_scales.resize(M);
+        dnnl::impl::parallel_nd(M, [&](int64_t mb) {
+            src_scales[mb] = quantize_dynamically(
+                    src + mb * K, K, 1, &src_q[mb * K]);
+        });
+        src = src_q.data();
+    }
+
+    gemm("C", "N", "T", M, N, K, 1.f, src, K, (float *)wei_m, K, 0.f,
             (float *)dst_tmp, N);
 
     dnnl::impl::parallel_nd(p->mb, p->oc, [&](int64_t mb, int64_t oc) {
@@ -38,6 +56,7 @@ void compute_ref_fwd(const engine_t &engine_tgt, const prb_t *p,
         float &dst = ((float *)dst_m)[dst_off];
 
         float d = ((float *)dst_tmp)[dst_off];
+        if (dyn_quant) d *= src_scales[mb];
         if (p->dir & FLAG_BIA) {
             size_t bia_off = bia_off_f(p, oc);
             d += ((float *)bia_m)[bia_off];
@@ -37,8 +37,78 @@ using namespace bnorm;
 
 namespace lnorm {
 
+static bool is_int8(const prb_t *p) {
+    return p->dt == dnnl_s8 || p->dt == dnnl_u8;
+}
+
+static void prepare_ss(const prb_t *p, dnn_mem_t &ss) {
+    dnnl::impl::parallel_nd(p->c, [&](int64_t c) {
+        if (p->flags & USE_SCALESHIFT) {
+            ((float *)ss)[c] = 1.f / 8 * (1 << (c % 7));
+            ((float *)ss)[p->c + c] = ((c % 3) - 1) * ((float *)ss)[c] / 64;
+        } else {
+            ((float *)ss)[c] = 1;
+            ((float *)ss)[p->c + c] = 0;
+        }
+    });
+}
+
+static int prepare_fwd_int8(const prb_t *p, dnn_mem_t &src, dnn_mem_t &mean,
+        dnn_mem_t &var, dnn_mem_t &ss) {
+    /** Idea: same as for the floating point data types, src[] values are
+     * integers with src[i] + src[i+1] = 2 * mean, so mean is exact. The
+     * deviations are limited so that the sum of squared deviations (and the
+     * sum of src) fits into the f32 mantissa, and variance is exact too. */
+    const int64_t exact_bits = digits_dt(dnnl_f32);
+    const int64_t max_sum = 1LL << exact_bits;
+
+    const bool is_u8 = p->dt == dnnl_u8;
+    if (p->c * (is_u8 ? 255 : 128) >= max_sum) return FAIL;
+
+    int64_t max_dev = is_u8 ? 127 : 124;
+    while (max_dev > 0 && p->c * max_dev * max_dev >= max_sum)
+        max_dev /= 2;
+    if (max_dev < 3) return FAIL;
+
+    dnnl::impl::parallel_nd(p->n, [&](int64_t n) {
+        const float m = is_u8 ? 128.f : (float)(n % 7 - 3);
+        float v = 0; /* current variance */
+
+        float *s = (float *)src + n * p->c;
+        for (int64_t c = 0; c < p->c; ++c) {
+            const int64_t l = c + n * 239 * 2; // l[0] must be even
+            const int64_t gen = (l / 2 * 1637) % (max_dev + 1);
+            const int sgn = l % 2 == 0 ? 1 : -1; /* [a1] */
+
+            s[c] = m + sgn * gen;
+            if (p->c % 2 && (c == p->c - 1)) { s[c] = m; }
+            v += (s[c] - m) * (s[c] - m);
+        }
+        mean.set_elem(n, m);
+        var.set_elem(n, v / p->c);
+    });
+
+    prepare_ss(p, ss);
+    return OK;
+}
+
+/** Splits src between the source and the second source, so that
+ * src[i] + src_add[i] is the original src[i] for any data type. The values
+ * go to the source and to the second source interchangeably to catch the
+ * kernels that read one of them twice. */
+static void prepare_add(const prb_t *p, dnn_mem_t &src, dnn_mem_t &src_add) {
+    dnnl::impl::parallel_nd(p->n * p->c, [&](int64_t i) {
+        float &s = ((float *)src)[i];
+        float &a = ((float *)src_add)[i];
+        a = i % 2 ? s : 0.f;
+        s = i % 2 ? 0.f : s;
+    });
+}
+
 static int prepare_fwd(const prb_t *p, dnn_mem_t &src, dnn_mem_t &mean,
         dnn_mem_t &var, dnn_mem_t &ss) {
+    if (is_int8(p)) return prepare_fwd_int8(p, src, mean, var, ss);
+
     /** Idea: choose src[] values so that both mean and variance are computed
      * exactly (independently of the order of the computations).
      *
@@ -110,15 +180,7 @@ static int prepare_fwd(const prb_t *p, dnn_mem_t &src, dnn_mem_t &mean,
         var.set_elem(n, v / p->c);
     });
 
-    dnnl::impl::parallel_nd(p->c, [&](int64_t c) {
-        if (p->flags & USE_SCALESHIFT) {
-            ((float *)ss)[c] = 1.f / 8 * (1 << (c % 7));
-            ((float *)ss)[p->c + c] = ((c % 3) - 1) * ((float *)ss)[c] / 64;
-        } else {
-            ((float *)ss)[c] = 1;
-            ((float *)ss)[p->c + c] = 0;
-        }
-    });
+    prepare_ss(p, ss);
     return OK;
 }
 /** @brief L = 2^k * P, P % 2 != 0 */
@@ -322,6 +384,11 @@ static int compare(const prb_t *p, data_kind_t kind, const dnn_mem_t &fp_mem,
                 }
             }
 
+            /* The integer results are rounded, so the values close to the
+             * middle of two integers might be rounded in different
+             * directions */
+            if (!ok && is_int8(p) && kind == DATA) ok = diff <= 1;
+
             r->errors += !ok;
 
             bool dump = false || (!ok && (r->errors < 10 || verbose >= 10))
@@ -518,6 +585,12 @@ int doit(const prb_t *p, res_t *r) {
 
     dnn_mem_t scratchpad_dt(scratchpad_md, engine_tgt);
 
+    dnn_mem_t src_add_fp, src_add_dt;
+    if (p->flags & FUSE_ADD_NORM) {
+        src_add_fp = dnn_mem_t(data_md, fp, tag, engine_tgt);
+        src_add_dt = dnn_mem_t(data_md, engine_tgt);
+    }
+
     dnn_mem_t d_dst_dt, placeholder_d_src_dt;
 
     args_t args;
@@ -528,6 +601,11 @@ int doit(const prb_t *p, res_t *r) {
             return r->state = MISTRUSTED, OK;
         }
 
+        if (p->flags & FUSE_ADD_NORM) {
+            prepare_add(p, src_fp, src_add_fp);
+            SAFE(src_add_dt.reorder(src_add_fp), WARN);
+        }
+
         SAFE(src_dt.reorder(src_fp), WARN);
         if (p->flags & GLOB_STATS) {
             /* prepare mean & var if they are inputs */
@@ -537,6 +615,7 @@ int doit(const prb_t *p, res_t *r) {
         if (p->flags & USE_SCALESHIFT) { SAFE(ss_dt.reorder(ss_fp), WARN); }
 
         args.set(DNNL_ARG_SRC, src_dt);
+        if (p->flags & FUSE_ADD_NORM) args.set(DNNL_ARG_SRC_1, src_add_dt);
         args.set(DNNL_ARG_DST, dst_dt);
         args.set(DNNL_ARG_MEAN, mean_dt);
         args.set(DNNL_ARG_VARIANCE, var_dt);
@@ -546,7 +625,8 @@ int doit(const prb_t *p, res_t *r) {
         DNN_SAFE(execute_and_wait(l, engine_tgt, args), WARN);
 
         if (bench_mode & CORR) {
-            compute_ref_fwd(p, src_fp, mean_fp, var_fp, ss_fp, dst_fp);
+            compute_ref_fwd(
+                    p, src_fp, src_add_fp, mean_fp, var_fp, ss_fp, dst_fp);
             if (!(p->flags & GLOB_STATS) && !(p->dir & FLAG_INF)) {
                 dnn_mem_t mean(mean_dt, fp, stat_tag, engine_tgt);
                 dnn_mem_t var(var_dt, fp, stat_tag, engine_tgt);
@@ -40,6 +40,7 @@ using flags_t = bnorm::flags_t;
 const flags_t NONE = bnorm::NONE;
 const flags_t GLOB_STATS = bnorm::GLOB_STATS;
 const flags_t USE_SCALESHIFT = bnorm::USE_SCALESHIFT;
+const flags_t FUSE_ADD_NORM = bnorm::FUSE_ADD_NORM;
 const auto flags2str = bnorm::flags2str;
 flags_t str2flags(const char *str);
 
@@ -114,8 +115,10 @@ struct prb_t {
         if (ops > 0) return;
         bool use_scaleshift = flags & USE_SCALESHIFT;
         if (dir & FLAG_FWD) {
+            bool fuse_add = flags & FUSE_ADD_NORM;
             ops = sizeof_dt(dt)
-                    * ((2 - inplace) * n * c + 2 * n + use_scaleshift * 2 * c);
+                    * ((2 - inplace + fuse_add) * n * c + 2 * n
+                            + use_scaleshift * 2 * c);
         } else {
             ops = sizeof_dt(dt)
                     * ((3 - inplace) * n * c + 2 * n + use_scaleshift * 2 * c
@@ -153,8 +156,9 @@ private:
     const prb_t *p_ = NULL;
 };
 
-void compute_ref_fwd(const prb_t *p, const dnn_mem_t &src, dnn_mem_t &mean,
-        dnn_mem_t &var, const dnn_mem_t &ss, dnn_mem_t &dst);
+void compute_ref_fwd(const prb_t *p, const dnn_mem_t &src,
+        const dnn_mem_t &src_add, dnn_mem_t &mean, dnn_mem_t &var,
+        const dnn_mem_t &ss, dnn_mem_t &dst);
 void compute_ref_bwd(const prb_t *p, const dnn_mem_t &src,
         const dnn_mem_t &mean, const dnn_mem_t &var, const dnn_mem_t &d_dst,
         const dnn_mem_t &ss, dnn_mem_t &d_src, dnn_mem_t &d_ss);
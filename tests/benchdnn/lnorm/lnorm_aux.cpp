@@ -22,7 +22,7 @@ namespace lnorm {
 
 flags_t str2flags(const char *str) {
     flags_t flags = bnorm::str2flags(str);
-    assert(flags <= (GLOB_STATS | USE_SCALESHIFT));
+    assert((flags & ~(GLOB_STATS | USE_SCALESHIFT | FUSE_ADD_NORM)) == 0);
     return flags;
 }
 
@@ -20,8 +20,9 @@
 
 namespace lnorm {
 
-void compute_ref_fwd(const prb_t *p, const dnn_mem_t &src, dnn_mem_t &mean,
-        dnn_mem_t &var, const dnn_mem_t &ss, dnn_mem_t &dst) {
+void compute_ref_fwd(const prb_t *p, const dnn_mem_t &src,
+        const dnn_mem_t &src_add, dnn_mem_t &mean, dnn_mem_t &var,
+        const dnn_mem_t &ss, dnn_mem_t &dst) {
     dnnl::impl::parallel_nd(p->n, [&](int64_t n) {
         float smean = ((float *)mean)[n];
         float svar = ((float *)var)[n];
@@ -33,8 +34,11 @@ void compute_ref_fwd(const prb_t *p, const dnn_mem_t &src, dnn_mem_t &mean,
             float beta
                     = p->flags & USE_SCALESHIFT ? ((float *)ss)[p->c + c] : 0;
             auto off = n * p->c + c;
-            float res = gamma * (((float *)src)[off] - smean) + beta;
+            float s = ((float *)src)[off];
+            if (p->flags & FUSE_ADD_NORM) s += ((float *)src_add)[off];
+            float res = gamma * (s - smean) + beta;
             float &D = ((float *)dst)[off];
+            res *= p->attr.oscale.scale;
             maybe_post_ops(res, D, p->attr);
             D = maybe_saturate(p->dt, res);
         }
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <vector>
+
 #include "tests/test_thread.hpp"
 
 #include "matmul/matmul.hpp"
@@ -33,14 +35,36 @@ void compute_ref(const engine_t &engine_tgt, const prb_t *p, dnn_mem_t &src_m,
 
     dnn_mem_t dst_tmp(dst_m.md_, dnnl_f32, dnnl_format_tag_undef, engine_tgt);
 
+    // f32 source with s8 weights is quantized with a scale per row and the
+    // results are dequantized with it
+    const bool dyn_quant
+            = p->cfg[SRC].dt == dnnl_f32 && p->cfg[WEI].dt == dnnl_s8;
+    std::vector<float> src_q, src_scales;
+    if (dyn_quant) {
+        src_q.resize(MB * M * K);
+        src_scales.resize(MB * M);
+        dnnl::impl::parallel_nd(MB, M, [&](int64_t mb, int64_t m) {
+            const float *src = (const float *)src_m + src_off_f(p, mb, m, 0);
+            src_scales[mb * M + m] = quantize_dynamically(
+                    src, K, 1, &src_q[(mb * M + m) * K]);
+        });
+    }
+
     dnnl::impl::parallel_nd(MB, M, N, [&](int64_t mb, int64_t m, int64_t n) {
         auto src = (const float *)src_m;
         auto wei = (const float *)wei_m;
 
         float dst = 0;
-        for (int64_t k = 0; k < K; ++k)
-            dst += (src[src_off_f(p, mb, m, k)] - src_zero_point)
-                    * (wei[wei_off_f(p, mb, k, n)] - wei_zero_point);
+        if (dyn_quant) {
+            const float *q = &src_q[(mb * M + m) * K];
+            for (int64_t k = 0; k < K; ++k)
+                dst += q[k] * wei[wei_off_f(p, mb, k, n)];
+            dst *= src_scales[mb * M + m];
+        } else {
+            for (int64_t k = 0; k < K; ++k)
+                dst += (src[src_off_f(p, mb, m, k)] - src_zero_point)
+                        * (wei[wei_off_f(p, mb, k, n)] - wei_zero_point);
+        }
 
         ((float *)dst_tmp)[dst_off_f(p, mb, m, n)] = dst;
     });
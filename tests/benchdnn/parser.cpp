@@ -221,6 +221,20 @@ static bool parse_fix_times_per_prb(
     return false;
 }
 
+static bool parse_warmup_times_per_prb(const char *str,
+        const std::string &option_name = "warmup-times-per-prb") {
+    if (parse_single_value_option(
+                warmup_times_per_prb, 0, atoi, str, option_name))
+        return warmup_times_per_prb = MAX2(0, warmup_times_per_prb), true;
+    return false;
+}
+
+static bool parse_cold_cache(
+        const char *str, const std::string &option_name = "cold-cache") {
+    return parse_single_value_option(
+            cold_cache, false, str2bool, str, option_name);
+}
+
 static bool parse_verbose(
         const char *str, const std::string &option_name = "verbose") {
     const std::string pattern("-v"); // check short option first
@@ -262,6 +276,12 @@ static bool parse_scratchpad_mode(
             option_name);
 }
 
+static bool parse_mem_placement(
+        const char *str, const std::string &option_name = "mem-placement") {
+    return parse_single_value_option(mem_placement, mem_placement_t(),
+            str2mem_placement, str, option_name);
+}
+
 static bool parse_skip_impl(
         const char *str, const std::string &option_name = "skip-impl") {
     const std::string pattern = get_pattern(option_name);
@@ -274,10 +294,12 @@ bool parse_bench_settings(const char *str) {
     last_parsed_is_problem = false; // if start parsing, expect an option
 
     return parse_bench_mode(str) || parse_max_ms_per_prb(str)
-            || parse_fix_times_per_prb(str) || parse_verbose(str)
+            || parse_fix_times_per_prb(str) || parse_warmup_times_per_prb(str)
+            || parse_cold_cache(str) || parse_verbose(str)
             || parse_engine_kind(str) || parse_fast_ref_gpu(str)
             || parse_canonical(str) || parse_mem_check(str)
-            || parse_scratchpad_mode(str) || parse_skip_impl(str);
+            || parse_scratchpad_mode(str) || parse_mem_placement(str)
+            || parse_skip_impl(str);
 }
 
 void catch_unknown_options(const char *str) {
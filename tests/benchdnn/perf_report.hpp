@@ -17,6 +17,7 @@
 #ifndef PERF_REPORT_HPP
 #define PERF_REPORT_HPP
 
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -44,6 +45,11 @@ struct base_perf_report_t {
         if (c == '-' || c == '0' || c == '+') {
             mode = modifier2mode(c);
             c = *(++option);
+        } else if (c == 'p' && isdigit(option[1])) {
+            char *end = nullptr;
+            mode = percentile2mode(strtol(option + 1, &end, 10));
+            option = end;
+            c = *option;
         }
 
         if (c == 'K' || c == 'M' || c == 'G') {
@@ -101,6 +107,11 @@ struct base_perf_report_t {
         HANDLE("ops", s << ops() / unit);
         HANDLE("time", s << t.ms(mode) / unit);
         HANDLE("impl", s << r->impl_name);
+        HANDLE("ctime", s << r->create_ms / unit);
+        HANDLE("ctime_hit", s << r->create_cache_hit_ms / unit);
+        HANDLE("scratchpad", s << r->scratchpad_size / unit);
+        HANDLE("workspace", s << r->workspace_size / unit);
+        HANDLE("weights", s << r->weights_size / unit);
 
 #undef HANDLE
 
@@ -169,6 +180,14 @@ private:
         return benchdnn_timer_t::min;
     }
 
+    static benchdnn_timer_t::mode_t percentile2mode(long p) {
+        if (p == 50) return benchdnn_timer_t::p50;
+        if (p == 90) return benchdnn_timer_t::p90;
+        if (p == 99) return benchdnn_timer_t::p99;
+        SAFE_V(FAIL);
+        return benchdnn_timer_t::min;
+    }
+
     static double modifier2unit(char c) {
         if (c == 'K') return 1e3;
         if (c == 'M') return 1e6;
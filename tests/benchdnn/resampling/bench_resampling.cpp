@@ -30,11 +30,12 @@ namespace resampling {
 
 void check_correctness(const settings_t &s) {
     for_(const auto &i_dir : s.dir)
-    for_(const auto &i_dt : s.dt)
+    for_(const auto &i_sdt : s.sdt)
+    for_(const auto &i_ddt : s.ddt)
     for_(const auto &i_tag : s.tag)
     for_(const auto &i_alg : s.alg)
     for (const auto &i_mb : s.mb) {
-        const prb_t p(s.desc, i_dir, i_dt, i_tag, i_alg, i_mb);
+        const prb_t p(s.desc, i_dir, i_sdt, i_ddt, i_tag, i_alg, s.attr, i_mb);
         std::stringstream ss;
         ss << p;
         const std::string cpp_pstr = ss.str();
@@ -56,6 +57,14 @@ void check_correctness(const settings_t &s) {
     }
 }
 
+// `--dt` sets both the src and the dst data types
+static bool parse_dt_both(
+        settings_t &s, const settings_t &def, const char *str) {
+    if (!parser::parse_dt(s.sdt, def.sdt, str)) return false;
+    s.ddt = s.sdt;
+    return true;
+}
+
 int bench(int argc, char **argv) {
     driver_name = "resampling";
     using namespace parser;
@@ -65,10 +74,13 @@ int bench(int argc, char **argv) {
         const bool parsed_options = parse_bench_settings(argv[0])
                 || parse_batch(bench, argv[0])
                 || parse_dir(s.dir, def.dir, argv[0])
-                || parse_dt(s.dt, def.dt, argv[0])
+                || parse_dt_both(s, def, argv[0])
+                || parse_dt(s.sdt, def.sdt, argv[0], "sdt")
+                || parse_dt(s.ddt, def.ddt, argv[0], "ddt")
                 || parse_tag(s.tag, def.tag, argv[0])
                 || parse_alg(s.alg, def.alg, str2alg, argv[0])
                 || parse_mb(s.mb, def.mb, argv[0])
+                || parse_attr(s.attr, argv[0])
                 || parse_allow_unimpl(s.allow_unimpl, argv[0])
                 || parse_perf_template(s.perf_template, s.perf_template_def,
                         s.perf_template_csv, argv[0])
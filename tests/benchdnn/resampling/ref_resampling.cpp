@@ -40,12 +40,17 @@ float weight(const int64_t y, const int64_t y_max, const int64_t x_max) {
     return fabs(linear_map(y, (float)y_max / x_max) - left(y, y_max, x_max));
 }
 void compute_ref_fwd(const prb_t *p, const dnn_mem_t &src, dnn_mem_t &dst) {
+    auto store = [&](int64_t dst_off, float res) {
+        res *= p->attr.oscale.scale;
+        maybe_post_ops(res, dst.get_elem(dst_off), p->attr);
+        dst.set_elem(dst_off, res);
+    };
     auto ker_nearest = [&](int64_t mb, int64_t ic, int64_t od, int64_t oh,
                                int64_t ow) {
         const int64_t id = near(od, p->od, p->id), ih = near(oh, p->oh, p->ih),
                       iw = near(ow, p->ow, p->iw);
         const auto dst_off = dst_off_f(p, mb, ic, od, oh, ow);
-        dst.set_elem(dst_off, src.get_elem(src_off_f(p, mb, ic, id, ih, iw)));
+        store(dst_off, src.get_elem(src_off_f(p, mb, ic, id, ih, iw)));
     };
     auto ker_linear = [&](int64_t mb, int64_t ic, int64_t od, int64_t oh,
                               int64_t ow) {
@@ -74,7 +79,7 @@ void compute_ref_fwd(const prb_t *p, const dnn_mem_t &src, dnn_mem_t &dst) {
         float cw = ch[0] * ww[0] + ch[1] * ww[1];
 
         const auto dst_off = dst_off_f(p, mb, ic, od, oh, ow);
-        dst.set_elem(dst_off, cw);
+        store(dst_off, cw);
     };
     dnnl::impl::parallel_nd(p->mb, p->ic, p->od, p->oh, p->ow,
             [&](int64_t mb, int64_t ic, int64_t od, int64_t oh, int64_t ow) {
@@ -27,6 +27,7 @@
 #include "dnnl_memory.hpp"
 #include "norm.hpp"
 
+#include "eltwise/eltwise.hpp"
 #include "resampling/resampling.hpp"
 
 namespace resampling {
@@ -36,6 +37,10 @@ inline int compare_dat(const prb_t *p, data_kind_t kind, dnn_mem_t &mem_dt,
     const auto nelems = mem_dt.nelems();
     r->errors = 0;
     r->total = nelems;
+    const auto dt = kind == SRC ? p->sdt : p->ddt;
+    const bool is_int8 = dt == dnnl_s8 || dt == dnnl_u8;
+    const int eltwise_idx = p->attr.post_ops.eltwise_index();
+    const bool has_eltwise = eltwise_idx >= 0;
 
     float trh = 0;
     if (p->alg == nearest) {
@@ -49,20 +54,33 @@ inline int compare_dat(const prb_t *p, data_kind_t kind, dnn_mem_t &mem_dt,
         if (p->dir & FLAG_FWD)
             trh = 0;
         else
-            trh = p->dt != dnnl_f32 ? epsilon_dt(p->dt) : 0;
+            trh = dt != dnnl_f32 ? epsilon_dt(dt) : 0;
     } else {
         assert(p->alg == linear);
-        trh = p->dt == dnnl_f32 ? 1e-6 : 1e-2;
+        trh = dt == dnnl_f32 ? 1e-6 : 1e-2;
     }
+    if (has_eltwise) trh = MAX2(trh, 4e-6f);
+    // The interpolation and the eltwise post-ops are computed in a different
+    // order or with approximations by the library, hence the rounding to an
+    // integer data type may end up in the neighboring value
+    const float int8_trh = p->alg == linear || has_eltwise ? 1 : 0;
+    // The signed values cancel each other out in the linear interpolation,
+    // so the small results are checked against the absolute error
+    const float abs_check_max
+            = p->alg == linear && p->sdt == dnnl_s8 ? 1.f : 1e-5f;
 
     for (int64_t i = 0; i < nelems; ++i) {
-        const float dt = mem_dt.get_elem(i);
+        const float dt_val = mem_dt.get_elem(i);
         const float fp0 = mem_fp.get_elem(i);
-        const float fp = maybe_saturate(p->dt, fp0);
+        const float fp = maybe_saturate(dt, fp0);
 
-        const float diff = fabsf(fp - dt);
+        const float diff = fabsf(fp - dt_val);
         const float rel_diff = diff / (fabsf(fp) > FLT_MIN ? fabsf(fp) : 1);
-        const bool ok = (fabsf(fp) > 1e-5 ? rel_diff : diff) <= trh;
+        const float err = fabsf(fp) > abs_check_max ? rel_diff : diff;
+        bool ok = is_int8 ? diff <= int8_trh : err <= trh;
+        if (!ok && has_eltwise)
+            ok = eltwise::check_extreme_values(
+                    fp, dt_val, p->attr.post_ops.entry[eltwise_idx].kind);
 
         r->errors += !ok;
 
@@ -77,7 +95,7 @@ inline int compare_dat(const prb_t *p, data_kind_t kind, dnn_mem_t &mem_dt,
                     "[%4ld][" IFMT "," IFMT "," IFMT "," IFMT "," IFMT
                     "] "
                     "fp:%8g fp0:%8g dt:%8g diff:%8g rdiff:%8g\n",
-                    (long)i, mb, ic, d, h, w, fp, fp0, dt, diff, rel_diff);
+                    (long)i, mb, ic, d, h, w, fp, fp0, dt_val, diff, rel_diff);
         }
     }
 
@@ -101,15 +119,16 @@ int compare_dst(
 int fill_dat(const prb_t *p, data_kind_t kind, dnn_mem_t &mem_dt,
         dnn_mem_t &mem_fp, res_t *r) {
     const auto nelems = mem_fp.nelems();
-    const auto dt = p->dt;
+    const auto dt = kind == SRC ? p->sdt : p->ddt;
     const int range = 16;
-    const int f_min = 0;
+    const int f_min = dt == dnnl_s8 ? -range / 2 : 0;
 
     dnnl::impl::parallel_nd(nelems, [&](int64_t i) {
         const float gen = ((97 * i) - 17 * kind + 101) % (range + 1);
         const float value = (dt == dnnl_f32)
                 ? (f_min + gen) * (1.0f + 4.0f / range)
-                : (f_min + gen) / range;
+                : (dt == dnnl_s8 || dt == dnnl_u8) ? f_min + gen
+                                                   : (f_min + gen) / range;
         mem_fp.set_elem(i, maybe_saturate(dt, value));
     });
 
@@ -148,11 +167,11 @@ static int init_pd(const engine_t &engine_tgt, const prb_t *p,
     std::string src_tag = (p->dir & FLAG_FWD) ? p->tag : tag::any;
     std::string dst_tag = tag::any;
 
-    DNN_SAFE(dnnl_memory_desc_init_by_tag(&src_d, p->ndims, src_dims, p->dt,
+    DNN_SAFE(dnnl_memory_desc_init_by_tag(&src_d, p->ndims, src_dims, p->sdt,
                      convert_tag(src_tag, p->ndims)),
             WARN);
 
-    DNN_SAFE(dnnl_memory_desc_init_by_tag(&dst_d, p->ndims, dst_dims, p->dt,
+    DNN_SAFE(dnnl_memory_desc_init_by_tag(&dst_d, p->ndims, dst_dims, p->ddt,
                      convert_tag(dst_tag, p->ndims)),
             WARN);
 
@@ -175,10 +194,10 @@ static int init_pd(const engine_t &engine_tgt, const prb_t *p,
     if (p->dir & FLAG_BWD) {
         dnnl_memory_desc_t fwd_src_d, fwd_dst_d;
         DNN_SAFE(dnnl_memory_desc_init_by_tag(&fwd_src_d, p->ndims, src_dims,
-                         p->dt, convert_tag(p->tag, p->ndims)),
+                         p->sdt, convert_tag(p->tag, p->ndims)),
                 WARN);
         DNN_SAFE(dnnl_memory_desc_init_by_tag(&fwd_dst_d, p->ndims, dst_dims,
-                         p->dt, convert_tag(tag::any, p->ndims)),
+                         p->ddt, convert_tag(tag::any, p->ndims)),
                 WARN);
 
         dnnl_resampling_desc_t rd_fwd;
@@ -193,7 +212,7 @@ static int init_pd(const engine_t &engine_tgt, const prb_t *p,
         SAFE(init_fwd_status, WARN);
     }
 
-    auto dnnl_attr = create_dnnl_attr(attr_t());
+    auto dnnl_attr = create_dnnl_attr(p->attr);
 
     dnnl_status_t init_status = dnnl_primitive_desc_create(
             &rpd, &pd, dnnl_attr, engine_tgt, _hint);
@@ -259,6 +278,8 @@ int doit(const prb_t *p, res_t *r) {
 
     if (p->dir & FLAG_FWD) {
         SAFE(fill_src(p, src_dt, src_fp, r), WARN);
+        if (p->attr.post_ops.find(attr_t::post_ops_t::kind_t::SUM) >= 0)
+            SAFE(fill_dst(p, dst_dt, dst_fp, r), WARN);
         args.set(DNNL_ARG_SRC, src_dt);
         args.set(DNNL_ARG_DST, dst_dt);
         args.set(DNNL_ARG_SCRATCHPAD, scratchpad_dt);
@@ -58,15 +58,16 @@ struct settings_t {
     desc_t desc {};
 
     std::vector<dir_t> dir {FWD_D};
-    std::vector<dnnl_data_type_t> dt {dnnl_f32};
+    std::vector<dnnl_data_type_t> sdt {dnnl_f32}, ddt {dnnl_f32};
     std::vector<std::string> tag {tag::abx};
     std::vector<alg_t> alg {nearest};
     std::vector<int64_t> mb {0};
+    attr_t attr = {};
     bool allow_unimpl = false;
 
     const char *perf_template_csv
-            = "perf,%engine%,%name%,%dir%,%dt%,%tag%,%alg%,%DESC%,%-time%,%"
-              "0time%";
+            = "perf,%engine%,%name%,%dir%,%sdt%,%ddt%,%tag%,%alg%,%attr%,"
+              "%DESC%,%-time%,%0time%";
     const char *perf_template_def
             = "perf,%engine%,%name%,%prb%,%-time%,%0time%";
     const char *perf_template = perf_template_def;
@@ -75,17 +76,25 @@ struct settings_t {
 };
 
 struct prb_t : public desc_t {
-    prb_t(const desc_t &desc, dir_t dir, dnnl_data_type_t dt,
-            const std::string &tag, alg_t alg, int64_t mb = 0)
-        : desc_t(desc), dir(dir), dt(dt), tag(tag), alg(alg) {
+    prb_t(const desc_t &desc, dir_t dir, dnnl_data_type_t sdt,
+            dnnl_data_type_t ddt, const std::string &tag, alg_t alg,
+            const attr_t &attr, int64_t mb = 0)
+        : desc_t(desc)
+        , dir(dir)
+        , sdt(sdt)
+        , ddt(ddt)
+        , tag(tag)
+        , alg(alg)
+        , attr(attr) {
         if (mb) this->mb = mb;
     }
     ~prb_t() {}
 
     dir_t dir;
-    dnnl_data_type_t dt;
+    dnnl_data_type_t sdt, ddt;
     std::string tag;
     alg_t alg;
+    attr_t attr;
 
     BENCHDNN_DISALLOW_COPY_AND_ASSIGN(prb_t);
 };
@@ -96,6 +105,7 @@ struct perf_report_t : public base_perf_report_t {
 
     void report(const prb_t *p, const res_t *r, const char *prb_str) {
         p_ = p;
+        sdt_ = {p_->sdt};
         base_report(r, prb_str);
     }
 
@@ -115,11 +125,16 @@ struct perf_report_t : public base_perf_report_t {
 
     const char *name() const override { return p_->name; }
     const dir_t *dir() const override { return &p_->dir; }
-    const dnnl_data_type_t *dt() const override { return &p_->dt; }
+    const attr_t *attr() const override { return &p_->attr; }
+    const std::vector<dnnl_data_type_t> *sdt() const override {
+        return &sdt_;
+    }
+    const dnnl_data_type_t *ddt() const override { return &p_->ddt; }
     const std::string *tag() const override { return &p_->tag; }
 
 private:
     const prb_t *p_ = NULL;
+    std::vector<dnnl_data_type_t> sdt_;
 };
 
 /* some extra control parameters which shouldn't be placed in prb_t */
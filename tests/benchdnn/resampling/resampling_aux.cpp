@@ -145,10 +145,12 @@ std::ostream &operator<<(std::ostream &s, const prb_t &p) {
     settings_t def;
 
     if (canonical || p.dir != def.dir[0]) s << "--dir=" << p.dir << " ";
-    if (canonical || p.dt != def.dt[0]) s << "--dt=" << p.dt << " ";
+    if (canonical || p.sdt != def.sdt[0]) s << "--sdt=" << p.sdt << " ";
+    if (canonical || p.ddt != def.ddt[0]) s << "--ddt=" << p.ddt << " ";
     if (canonical || p.tag != def.tag[0]) s << "--tag=" << p.tag << " ";
     if (canonical || p.alg != def.alg[0])
         s << "--alg=" << alg2str(p.alg) << " ";
+    if (canonical || !p.attr.is_def()) s << "--attr=\"" << p.attr << "\" ";
 
     s << static_cast<const desc_t &>(p);
 
@@ -263,6 +263,40 @@ TEST_F(attr_test, DepthwiseFusionPostop) {
     ASSERT_EQ(dst_dt, memory::data_type::f32);
     ASSERT_EQ(scales_mask, 1 << 1);
     ASSERT_EQ(scales_in, scales_out);
+
+    memory::dim kernel, stride, padding;
+
+    scales_in = {2};
+    ops.append_dw(memory::data_type::s8, memory::data_type::undef,
+            memory::data_type::s8, 5, 2, 2, 0, scales_in);
+    attr.set_post_ops(ops);
+
+    ASSERT_EQ(attr.get_post_ops().kind(2), primitive::kind::convolution);
+
+    attr.get_post_ops().get_params_dw(2, wei_dt, bias_dt, dst_dt, kernel,
+            stride, padding, scales_mask, scales_out);
+
+    ASSERT_EQ(wei_dt, memory::data_type::s8);
+    ASSERT_EQ(bias_dt, memory::data_type::undef);
+    ASSERT_EQ(dst_dt, memory::data_type::s8);
+    ASSERT_EQ(kernel, 5);
+    ASSERT_EQ(stride, 2);
+    ASSERT_EQ(padding, 2);
+    ASSERT_EQ(scales_mask, 0);
+    ASSERT_EQ(scales_in, scales_out);
+
+    // the shortcut getters match the 3x3 kernel only
+    EXPECT_ANY_THROW(attr.get_post_ops().get_params_dw_k3s2p1(
+            2, wei_dt, bias_dt, dst_dt, scales_mask, scales_out));
+    attr.get_post_ops().get_params_dw(0, wei_dt, bias_dt, dst_dt, kernel,
+            stride, padding, scales_mask, scales_out);
+    ASSERT_EQ(kernel, 3);
+    ASSERT_EQ(stride, 1);
+    ASSERT_EQ(padding, 1);
+
+    EXPECT_ANY_THROW(ops.append_dw(memory::data_type::s8,
+            memory::data_type::undef, memory::data_type::s8, 3, 1, 3, 0,
+            scales_in));
 }
 
 TEST_F(attr_test, DepthwiseFusion) {
@@ -0,0 +1,241 @@
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+#include "dnnl.hpp"
+#include "dnnl_test_common.hpp"
+
+#include "gtest/gtest.h"
+
+namespace dnnl {
+
+// Keeps track of the live allocations made through the engine allocator
+struct counting_allocator_t {
+    std::map<void *, size_t> live;
+    size_t n_allocs = 0;
+    size_t n_frees = 0;
+    bool size_mismatch = false;
+    bool misaligned = false;
+
+    static void *allocate(size_t size, size_t alignment, void *user_data) {
+        auto *self = static_cast<counting_allocator_t *>(user_data);
+        void *ptr = nullptr;
+#ifdef _WIN32
+        ptr = _aligned_malloc(size, alignment);
+#else
+        if (posix_memalign(&ptr, alignment, size) != 0) ptr = nullptr;
+#endif
+        if (ptr == nullptr) return nullptr;
+        if (reinterpret_cast<uintptr_t>(ptr) % alignment != 0)
+            self->misaligned = true;
+        self->live[ptr] = size;
+        self->n_allocs++;
+        return ptr;
+    }
+
+    static void free(void *ptr, size_t size, void *user_data) {
+        auto *self = static_cast<counting_allocator_t *>(user_data);
+        auto it = self->live.find(ptr);
+        if (it == self->live.end() || it->second != size)
+            self->size_mismatch = true;
+        if (it != self->live.end()) self->live.erase(it);
+        self->n_frees++;
+#ifdef _WIN32
+        _aligned_free(ptr);
+#else
+        ::free(ptr);
+#endif
+    }
+
+    dnnl_allocator_t get() {
+        return {&counting_allocator_t::allocate, &counting_allocator_t::free,
+                this};
+    }
+};
+
+class engine_allocator_test : public ::testing::Test {};
+
+TEST_F(engine_allocator_test, TestMemoryAllocation) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "User-provided allocator is supported by CPU engine only");
+
+    counting_allocator_t alloc;
+    {
+        engine eng(engine::kind::cpu, 0, alloc.get());
+        memory::desc md({2, 16, 7, 7}, memory::data_type::f32,
+                memory::format_tag::nchw);
+        memory mem(md, eng);
+        ASSERT_EQ(alloc.n_allocs, 1U);
+        ASSERT_EQ(alloc.live.size(), 1U);
+        ASSERT_GE(alloc.live.begin()->second, md.get_size());
+        ASSERT_EQ(mem.get_data_handle(), alloc.live.begin()->first);
+
+        // User-provided buffers are not allocated by the library
+        std::vector<float> buf(md.get_size() / sizeof(float));
+        memory user_mem(md, eng, buf.data());
+        ASSERT_EQ(alloc.n_allocs, 1U);
+    }
+    ASSERT_EQ(alloc.n_frees, 1U);
+    ASSERT_TRUE(alloc.live.empty());
+    ASSERT_FALSE(alloc.size_mismatch);
+    ASSERT_FALSE(alloc.misaligned);
+}
+
+TEST_F(engine_allocator_test, TestScratchpadAllocation) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "User-provided allocator is supported by CPU engine only");
+
+    counting_allocator_t alloc;
+    {
+        engine eng(engine::kind::cpu, 0, alloc.get());
+        stream strm(eng);
+
+        // Plain layouts lead to a GEMM-based convolution with a scratchpad
+        memory::desc src_md({2, 3, 13, 13}, memory::data_type::f32,
+                memory::format_tag::nchw);
+        memory::desc wei_md({8, 3, 3, 3}, memory::data_type::f32,
+                memory::format_tag::oihw);
+        memory::desc dst_md({2, 8, 11, 11}, memory::data_type::f32,
+                memory::format_tag::nchw);
+        auto desc = convolution_forward::desc(prop_kind::forward_inference,
+                algorithm::convolution_direct, src_md, wei_md, dst_md, {1, 1},
+                {0, 0}, {0, 0});
+        auto pd = convolution_forward::primitive_desc(desc, eng);
+        const size_t scratchpad_size = pd.scratchpad_desc().get_size();
+
+        const size_t n_allocs_before = alloc.n_allocs;
+        auto conv = convolution_forward(pd);
+        if (scratchpad_size > 0)
+            ASSERT_EQ(alloc.n_allocs, n_allocs_before + 1);
+
+        memory src(pd.src_desc(), eng), wei(pd.weights_desc(), eng),
+                dst(pd.dst_desc(), eng);
+        conv.execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        strm.wait();
+    }
+    ASSERT_EQ(alloc.n_allocs, alloc.n_frees);
+    ASSERT_TRUE(alloc.live.empty());
+    ASSERT_FALSE(alloc.size_mismatch);
+}
+
+TEST_F(engine_allocator_test, TestScratchpadPool) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "User-provided allocator is supported by CPU engine only");
+
+    counting_allocator_t alloc;
+    {
+        engine eng(engine::kind::cpu, 0, alloc.get());
+        eng.set_scratchpad_pool_capacity(16 * 1024 * 1024);
+        ASSERT_EQ(eng.get_scratchpad_pool_capacity(), 16U * 1024 * 1024);
+
+        memory::desc src_md({2, 3, 13, 13}, memory::data_type::f32,
+                memory::format_tag::nchw);
+        memory::desc wei_md({8, 3, 3, 3}, memory::data_type::f32,
+                memory::format_tag::oihw);
+        memory::desc dst_md({2, 8, 11, 11}, memory::data_type::f32,
+                memory::format_tag::nchw);
+        auto desc = convolution_forward::desc(prop_kind::forward_inference,
+                algorithm::convolution_direct, src_md, wei_md, dst_md, {1, 1},
+                {0, 0}, {0, 0});
+        auto pd = convolution_forward::primitive_desc(desc, eng);
+        SKIP_IF(pd.scratchpad_desc().get_size() == 0,
+                "Implementation does not use a scratchpad");
+
+        { auto conv = convolution_forward(pd); }
+        const size_t n_allocs = alloc.n_allocs;
+        ASSERT_FALSE(alloc.live.empty());
+
+        // The scratchpad of the destroyed primitive is reused
+        { auto conv = convolution_forward(pd); }
+        ASSERT_EQ(alloc.n_allocs, n_allocs);
+
+        // Disabling the pool frees the cached buffers
+        eng.set_scratchpad_pool_capacity(0);
+        ASSERT_TRUE(alloc.live.empty());
+    }
+    ASSERT_EQ(alloc.n_allocs, alloc.n_frees);
+    ASSERT_FALSE(alloc.size_mismatch);
+}
+
+TEST_F(engine_allocator_test, TestInvalidAllocator) {
+    dnnl_allocator_t alloc = {nullptr, nullptr, nullptr};
+    dnnl_engine_t eng = nullptr;
+    ASSERT_EQ(dnnl_engine_create_with_allocator(&eng, dnnl_cpu, 0, &alloc),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_engine_create_with_allocator(&eng, dnnl_cpu, 0, nullptr),
+            dnnl_invalid_arguments);
+}
+
+TEST_F(engine_allocator_test, TestCpuMemoryPlacement) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Memory placement is supported by CPU engine only");
+
+    using placement = engine::cpu_memory_placement;
+    engine eng(engine::kind::cpu, 0);
+    ASSERT_EQ(eng.get_cpu_memory_placement(), placement::default_placement);
+
+    const unsigned flags = dnnl_cpu_memory_placement_huge_pages
+            | dnnl_cpu_memory_placement_numa_interleave;
+    dnnl_status_t status
+            = dnnl_engine_set_cpu_memory_placement(eng.get(), flags, 0);
+    SKIP_IF(status == dnnl_unimplemented,
+            "Memory placement is not supported by the system");
+    ASSERT_EQ(status, dnnl_success);
+    ASSERT_EQ(eng.get_cpu_memory_placement(),
+            placement::huge_pages | placement::numa_interleave);
+
+    // Both the large and the small buffers are usable
+    for (memory::dim n : {16, 1024 * 1024 + 3}) {
+        memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+        memory mem(md, eng);
+        auto *ptr = static_cast<float *>(mem.get_data_handle());
+        ASSERT_NE(ptr, nullptr);
+        for (memory::dim i = 0; i < n; ++i)
+            ptr[i] = (float)i;
+        ASSERT_EQ(ptr[n - 1], (float)(n - 1));
+    }
+
+    int numa_node = -1;
+    eng.set_cpu_memory_placement(placement::numa_bind, 0);
+    ASSERT_EQ(eng.get_cpu_memory_placement(&numa_node), placement::numa_bind);
+    ASSERT_EQ(numa_node, 0);
+
+    // The NUMA policies are mutually exclusive
+    ASSERT_EQ(dnnl_engine_set_cpu_memory_placement(eng.get(),
+                      dnnl_cpu_memory_placement_numa_interleave
+                              | dnnl_cpu_memory_placement_numa_bind,
+                      0),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_engine_set_cpu_memory_placement(
+                      eng.get(), dnnl_cpu_memory_placement_numa_bind, -1),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_engine_set_cpu_memory_placement(eng.get(), 0x80U, 0),
+            dnnl_invalid_arguments);
+
+    // The placement cannot be combined with a user-provided allocator
+    counting_allocator_t alloc;
+    engine alloc_eng(engine::kind::cpu, 0, alloc.get());
+    ASSERT_EQ(dnnl_engine_set_cpu_memory_placement(alloc_eng.get(), flags, 0),
+            dnnl_invalid_arguments);
+}
+
+} // namespace dnnl
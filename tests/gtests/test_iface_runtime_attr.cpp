@@ -95,13 +95,7 @@ TEST_F(runtime_attr_test, TestConv) {
             {1, 1}, {1, 1});
     CHECK_OK(convolution_forward::primitive_desc(op_d, eng));
     CHECK_OK(convolution_forward::primitive_desc(op_d, gen_attr(false), eng));
-    if (get_test_engine_kind() == engine::kind::gpu) {
-        CHECK_OK(
-                convolution_forward::primitive_desc(op_d, gen_attr(true), eng));
-    } else {
-        CHECK_UNIMPL(
-                convolution_forward::primitive_desc(op_d, gen_attr(true), eng));
-    }
+    CHECK_OK(convolution_forward::primitive_desc(op_d, gen_attr(true), eng));
 }
 
 TEST_F(runtime_attr_test, TestDeconv) {
@@ -139,8 +133,13 @@ TEST_F(runtime_attr_test, TestInnerProduct) {
             prop_kind::forward, src_md, wei_md, dst_md);
     CHECK_OK(inner_product_forward::primitive_desc(op_d, eng));
     CHECK_OK(inner_product_forward::primitive_desc(op_d, gen_attr(false), eng));
-    CHECK_UNIMPL(
-            inner_product_forward::primitive_desc(op_d, gen_attr(true), eng));
+    if (get_test_engine_kind() == engine::kind::cpu) {
+        CHECK_OK(inner_product_forward::primitive_desc(
+                op_d, gen_attr(true), eng));
+    } else {
+        CHECK_UNIMPL(inner_product_forward::primitive_desc(
+                op_d, gen_attr(true), eng));
+    }
 }
 
 TEST_F(runtime_attr_test, TestLNorm) {
@@ -151,8 +150,13 @@ TEST_F(runtime_attr_test, TestLNorm) {
         layer_normalization_forward::desc op_d(
                 prop_kind::forward_inference, md, stat_md, 0.1f, flags);
         CHECK_OK(layer_normalization_forward::primitive_desc(op_d, eng));
-        CHECK_UNIMPL(layer_normalization_forward::primitive_desc(
-                op_d, gen_attr(false), eng));
+        if (get_test_engine_kind() == engine::kind::cpu) {
+            CHECK_OK(layer_normalization_forward::primitive_desc(
+                    op_d, gen_attr(false), eng));
+        } else {
+            CHECK_UNIMPL(layer_normalization_forward::primitive_desc(
+                    op_d, gen_attr(false), eng));
+        }
         CHECK_UNIMPL(layer_normalization_forward::primitive_desc(
                 op_d, gen_attr(true), eng));
     }